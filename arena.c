@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENA_ALIGN 16              // Enough for anything we put in one
+#define ARENA_FIRST_BLOCK 16384     // Blocks double from here as the arena fills
+#define ARENA_MAX_BLOCK 4194304     // until they reach this
+
+#define ARENA_HEADER ((sizeof(arenaBlock) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+void *arenaAlloc(arena *a, size_t size)
+{
+    arenaBlock *block = a->head;
+    void *memory;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+    if (block == NULL || block->size - block->used < size)
+    {
+        size_t room = block ? block->size * 2 : ARENA_FIRST_BLOCK;
+        if (room > ARENA_MAX_BLOCK)
+            room = ARENA_MAX_BLOCK;
+        if (room < size)
+            room = size;
+        block = malloc(ARENA_HEADER + room);
+        if (block == NULL)
+            return NULL;
+        block->next = a->head;
+        block->size = room;
+        block->used = 0;
+        a->head = block;
+    }
+    memory = (char *)block + ARENA_HEADER + block->used;
+    block->used += size;
+    memset(memory, 0, size);
+    return memory;
+}
+
+void arenaFree(arena *a)
+{
+    arenaBlock *block = a->head, *next;
+    while (block != NULL)
+    {
+        next = block->next;
+        free(block);
+        block = next;
+    }
+    a->head = NULL;
+}
@@ -0,0 +1,27 @@
+#ifndef ARENA_H_INCLUDED
+#define ARENA_H_INCLUDED
+
+#include <stddef.h>
+
+/**
+ *  A bump allocator. Allocations are carved one after another out of big
+ *  blocks and are never freed on their own, arenaFree releases everything
+ *  at once. Good for things like the syntax tree, which is built a node at a
+ *  time and thrown away all together.
+ */
+typedef struct arenaBlock
+{
+    struct arenaBlock *next;    // The block we filled before this one
+    size_t size;                // Bytes of room after the header
+    size_t used;                // Bytes handed out so far
+} arenaBlock;
+
+typedef struct arena
+{
+    arenaBlock *head;           // The block we're allocating from, NULL until the first allocation
+} arena;
+
+void *arenaAlloc(arena *a, size_t size);    // Returns size zeroed bytes, or NULL if we're out of memory
+void arenaFree(arena *a);                   // Releases every allocation at once
+
+#endif // ARENA_H_INCLUDED
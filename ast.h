@@ -0,0 +1,89 @@
+#ifndef AST_H_INCLUDED
+#define AST_H_INCLUDED
+
+#include "compiler.h"
+#include "arena.h"
+
+/**
+ *  The syntax tree the parser builds and the code generator walks.
+ *
+ *  Names are already resolved when a node is made: a node that uses an
+ *  identifier holds the index of its symbol in the symbol table, which keeps
+ *  every declaration in the program, not just the ones in scope.
+ *
+ *  AST_BLOCK       value is the frame size, kid[0] the first procedure, kid[1] the statement
+ *  AST_PROCEDURE   value is the procedure's symbol, kid[0] its block, next the next procedure
+ *  AST_ASSIGN      value is the variable's symbol, kid[0] the expression
+ *  AST_CALL        value is the procedure's symbol
+ *  AST_BEGIN       kid[0] the first statement, each statement's next the one after it
+ *  AST_IF          kid[0] the condition, kid[1] the then, kid[2] the else or NULL
+ *  AST_WHILE       kid[0] the condition, kid[1] the body
+ *  AST_READ        value is the variable's symbol
+ *  AST_WRITE       value is the symbol written out
+ *  AST_EMPTY       a statement with nothing in it
+ *  AST_NUMBER      value is the number
+ *  AST_IDENT       value is the constant or variable's symbol
+ *  AST_NEGATE      kid[0] the expression
+ *  AST_BINARY      op is the OPR m of + - * /, kid[0] and kid[1] the operands
+ *  AST_ODD         kid[0] the expression
+ *  AST_COMPARE     op is the OPR m of the comparison, kid[0] and kid[1] the operands
+ */
+enum AST_Kind
+{
+    AST_BLOCK = 1,
+    AST_PROCEDURE,
+    AST_ASSIGN,
+    AST_CALL,
+    AST_BEGIN,
+    AST_IF,
+    AST_WHILE,
+    AST_READ,
+    AST_WRITE,
+    AST_EMPTY,
+    AST_NUMBER,
+    AST_IDENT,
+    AST_NEGATE,
+    AST_BINARY,
+    AST_ODD,
+    AST_COMPARE
+};
+
+typedef struct astNode
+{
+    short kind;             // One of AST_Kind
+    short op;               // OPR m for AST_BINARY and AST_COMPARE
+    int value;              // Number or symbol index, see above
+    struct astNode *kid[3];
+    struct astNode *next;   // Next statement in a begin, next procedure in a block
+} astNode;
+
+typedef struct symbol
+{
+    int kind;       // const = 1, var = 2, proc = 3
+    int name;       // name id from the lexer's name table
+    int val;        // number
+    int level;      // L level
+    int addr;       // M address. For procedures it's set by the code generator
+    int shadow;     // index of the symbol with the same name this one hides, -1 if none
+} symbol;
+
+/**
+ *  The program being generated. It doubles whenever it fills, so anything
+ *  holding on to an instruction keeps its index, not a pointer.
+ */
+typedef struct codeBuffer
+{
+    command *code;
+    int count;              // Instructions generated so far
+    int capacity;           // Instructions code has room for
+    int failed;             // 1 if we ran out of memory, the program is incomplete
+    int classic;            // 1 to bark only the nine classic instructions, no fused ones
+} codeBuffer;
+
+int generateCode(astNode *program, symbol *symbols, codeBuffer *out);  // Appends the PM/0 for the program to out, returns 1 if it ran out of memory
+void foldConstants(astNode *program, symbol *symbols);  // Works out at compile time whatever doesn't need the VM, see fold.c
+int inlineCalls(astNode *program, symbol **symbols, int *symbolCount, int *symbolCap, arena *nodes, int limit);  // Replaces calls to small leaf procedures with their bodies, returns how many, see inliner.c
+int pruneProcedures(astNode *program, symbol *symbols, int symbolCount);  // Leaves out the procedures no call can reach, returns how many, see callgraph.c
+void peephole(codeBuffer *out, int *entries, int entryCount);   // Threads jumps and takes out code that does nothing, moving entries along with the code, see peephole.c
+
+#endif // AST_H_INCLUDED
@@ -0,0 +1,379 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "lexer.h"
+#include "compiler.h"
+#include "batch.h"
+
+/**
+ *  Every .pl0 file the batch was asked for, sorted so the report always
+ *  comes out in the same order.
+ */
+typedef struct fileList
+{
+    int count;
+    int capacity;
+    char **path;
+} fileList;
+
+/**
+ *  How one file went. Each worker only ever writes the results of the files
+ *  it took, so these need no locking.
+ */
+typedef struct batchResult
+{
+    int failed;             // 1 if the file didn't compile or couldn't be read or written
+    double ms;              // Time from opening the source to closing the .pm0
+    char error[256];        // First error, its lines joined with "; "
+} batchResult;
+
+/**
+ *  One worker's share of the files, the indices top to bottom-1 of the list.
+ *  The worker takes files off the bottom. Once its own run out it steals the
+ *  top half of somebody else's, so whoever drew the big files gets help
+ *  without anyone handing work out up front. Files are never added, only
+ *  moved, so a worker can quit once every queue is empty.
+ */
+typedef struct workQueue
+{
+    pthread_mutex_t lock;
+    int top;
+    int bottom;
+} workQueue;
+
+typedef struct batchPool
+{
+    fileList *files;
+    batchResult *results;
+    workQueue *queues;
+    int threads;
+    pl0Cache *cache;        // NULL if we aren't caching
+    int binary;             // 1 to write PM0B instead of text
+} batchPool;
+
+typedef struct batchWorker
+{
+    batchPool *pool;
+    int id;
+} batchWorker;
+
+static double nowMs()
+{
+#ifndef _WIN32
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#else
+    return clock() * 1000.0 / CLOCKS_PER_SEC;
+#endif
+}
+
+static int endsWith(const char *text, const char *suffix)
+{
+    size_t length = strlen(text), suffixLength = strlen(suffix);
+    return length >= suffixLength && strcmp(text + length - suffixLength, suffix) == 0;
+}
+
+static void addFile(fileList *files, const char *path)
+{
+    if (files->count == files->capacity)
+    {
+        files->capacity = files->capacity ? files->capacity * 2 : 64;
+        files->path = realloc(files->path, files->capacity * sizeof(char *));
+    }
+    files->path[files->count] = malloc(strlen(path) + 1);
+    strcpy(files->path[files->count], path);
+    files->count++;
+}
+
+static void addPath(fileList *files, const char *path);
+
+static void addDirectory(fileList *files, const char *path)
+{
+    DIR *dir = opendir(path);
+    struct dirent *entry;
+    char *child;
+
+    if (dir == NULL)
+        return;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+            continue;
+        child = malloc(strlen(path) + strlen(entry->d_name) + 2);
+        sprintf(child, "%s/%s", path, entry->d_name);
+        if (endsWith(child, ".pl0"))
+            addFile(files, child);
+        else
+        {
+            struct stat info;
+            if (stat(child, &info) == 0 && S_ISDIR(info.st_mode))
+                addDirectory(files, child);         // Other files in the tree aren't ours, only look inside directories
+        }
+        free(child);
+    }
+    closedir(dir);
+}
+
+static void addList(fileList *files, const char *path)
+{
+    FILE *list = fopen(path, "r");
+    char line[4096];
+    size_t length;
+
+    if (list == NULL)
+    {
+        addFile(files, path);                       // Let it fail like any other missing file, so it shows up in the report
+        return;
+    }
+    while (fgets(line, sizeof(line), list) != NULL)
+    {
+        length = strlen(line);
+        while (length > 0 && (line[length-1] == '\n' || line[length-1] == '\r' || line[length-1] == ' '))
+            line[--length] = '\0';
+        if (length > 0)
+            addPath(files, line);
+    }
+    fclose(list);
+}
+
+static void addPath(fileList *files, const char *path)
+{
+    struct stat info;
+    if (stat(path, &info) == 0 && S_ISDIR(info.st_mode))
+        addDirectory(files, path);
+    else if (endsWith(path, ".pl0"))
+        addFile(files, path);
+    else
+        addList(files, path);
+}
+
+static int comparePaths(const void *a, const void *b)
+{
+    return strcmp(*(char * const *)a, *(char * const *)b);
+}
+
+/**
+ *  Copies message into to as a single line, its lines joined with "; "
+ */
+static void joinLines(char *to, size_t size, const char *message)
+{
+    size_t used = 0;
+    for (; *message != '\0' && used + 1 < size; message++)
+    {
+        if (*message != '\n')
+            to[used++] = *message;
+        else if (message[1] != '\0')
+        {
+            if (used + 3 >= size)
+                break;
+            to[used++] = ';';
+            to[used++] = ' ';
+        }
+    }
+    to[used] = '\0';
+}
+
+/**
+ *  Compiles one file and writes its .pm0, the same as running the command
+ *  line compiler on it, except that what it would have printed goes into
+ *  result instead.
+ */
+static void compileFile(const char *path, int binary, pl0Cache *cache, batchResult *result)
+{
+    lexSource source;
+    pl0Program program;
+    pl0Options options = {0};
+    FILE *outFile;
+    char *outName;
+    pl0CacheKey key;
+    double started = nowMs();
+
+    options.lexThreads = 1;                         // The pool already has every core busy
+    if (openSource(&source, path))
+    {
+        result->failed = 1;
+        strcpy(result->error, "Error, File not found!");
+        result->ms = nowMs() - started;
+        return;
+    }
+    outName = malloc(strlen(path) + 6);
+    strcpy(outName, path);
+    strcpy(outName + strlen(outName) - 4, binary ? ".pm0b" : ".pm0");   // Only .pl0 files get here, see addDirectory and addPath
+
+    if (cache != NULL)
+    {
+        cacheKey(&key, source.text, source.length, &options, binary);
+        if (cacheFetch(cache, &key, outName))
+        {
+            closeSource(&source);
+            free(outName);
+            result->ms = nowMs() - started;
+            return;
+        }
+    }
+    if (pl0_compile(source.text, source.length, &options, &program))
+    {
+        result->failed = 1;
+        joinLines(result->error, sizeof(result->error), program.message);
+        closeSource(&source);
+        free(outName);
+        result->ms = nowMs() - started;
+        return;
+    }
+
+    outFile = fopen(outName, binary ? "wb" : "w");
+    if (outFile == NULL || (binary ? pl0_emitBinary(&program, outFile) : pl0_emit(&program, outFile)))
+    {
+        result->failed = 1;
+        snprintf(result->error, sizeof(result->error), "Could not write %s", outName);
+    }
+    if (outFile != NULL)
+        fclose(outFile);
+    if (cache != NULL && !result->failed)
+        cacheStore(cache, &key, outName);
+    closeSource(&source);                           // Not before, the cache compares entries with the source
+    free(outName);
+    pl0_free(&program);
+    result->ms = nowMs() - started;
+}
+
+static int takeOwn(workQueue *queue)
+{
+    int file = -1;
+    pthread_mutex_lock(&queue->lock);
+    if (queue->bottom > queue->top)
+        file = --queue->bottom;
+    pthread_mutex_unlock(&queue->lock);
+    return file;
+}
+
+/**
+ *  Moves the top half of the first non-empty queue after ours into ours and
+ *  returns one file from it, or -1 if everyone is out of work.
+ */
+static int steal(batchPool *pool, int id)
+{
+    workQueue *mine = &pool->queues[id], *victim;
+    int i, top, half;
+
+    for (i = 1; i < pool->threads; i++)
+    {
+        victim = &pool->queues[(id + i) % pool->threads];
+        pthread_mutex_lock(&victim->lock);
+        half = (victim->bottom - victim->top + 1) / 2;
+        top = victim->top;
+        victim->top += half;
+        pthread_mutex_unlock(&victim->lock);
+        if (half > 0)
+        {
+            pthread_mutex_lock(&mine->lock);
+            mine->top = top;
+            mine->bottom = top + half - 1;          // The last one we return straight away
+            pthread_mutex_unlock(&mine->lock);
+            return top + half - 1;
+        }
+    }
+    return -1;
+}
+
+static void *batchWorkerMain(void *arg)
+{
+    batchWorker *worker = arg;
+    batchPool *pool = worker->pool;
+    int file;
+
+    for (;;)
+    {
+        file = takeOwn(&pool->queues[worker->id]);
+        if (file < 0)
+            file = steal(pool, worker->id);
+        if (file < 0)
+            break;
+        compileFile(pool->files->path[file], pool->binary, pool->cache, &pool->results[file]);
+    }
+    return NULL;
+}
+
+int batchCompile(char **paths, int count, int threads, int binary, pl0Cache *cache, FILE *report)
+{
+    fileList files = {0, 0, NULL};
+    batchPool pool;
+    batchWorker *workers;
+    pthread_t *handles;
+    double started, busy = 0;
+    int i, failed = 0;
+
+    for (i = 0; i < count; i++)
+        addPath(&files, paths[i]);
+    if (files.count > 1)
+        qsort(files.path, files.count, sizeof(char *), comparePaths);
+
+    if (threads <= 0)
+    {
+#ifdef _SC_NPROCESSORS_ONLN
+        threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+        threads = 1;
+#endif
+    }
+    if (threads > files.count)
+        threads = files.count > 0 ? files.count : 1;
+
+    pool.files = &files;
+    pool.results = calloc(files.count + 1, sizeof(batchResult));
+    pool.queues = malloc(threads * sizeof(workQueue));
+    pool.threads = threads;
+    pool.cache = cache;
+    pool.binary = binary;
+    workers = malloc(threads * sizeof(batchWorker));
+    handles = malloc(threads * sizeof(pthread_t));
+
+    started = nowMs();
+    for (i = 0; i < threads; i++)                   // Everyone starts with an even, contiguous share
+    {
+        pthread_mutex_init(&pool.queues[i].lock, NULL);
+        pool.queues[i].top = (int)((long long)files.count * i / threads);
+        pool.queues[i].bottom = (int)((long long)files.count * (i + 1) / threads);
+        workers[i].pool = &pool;
+        workers[i].id = i;
+    }
+    for (i = 1; i < threads; i++)
+        pthread_create(&handles[i], NULL, batchWorkerMain, &workers[i]);
+    batchWorkerMain(&workers[0]);                   // This thread works too
+    for (i = 1; i < threads; i++)
+        pthread_join(handles[i], NULL);
+
+    for (i = 0; i < files.count; i++)
+    {
+        busy += pool.results[i].ms;
+        failed += pool.results[i].failed;
+        if (pool.results[i].failed)
+            fprintf(report, "FAIL %10.3f ms  %s: %s\n", pool.results[i].ms, files.path[i], pool.results[i].error);
+        else
+            fprintf(report, "PASS %10.3f ms  %s\n", pool.results[i].ms, files.path[i]);
+    }
+    fprintf(report, "%d files, %d passed, %d failed. %.3f ms on %d threads, %.3f ms of compiling.\n",
+            files.count, files.count - failed, failed, nowMs() - started, threads, busy);
+    if (cache != NULL)
+        fprintf(report, "Cache: %lld hits, %lld misses, %lld stored, %lld evicted.\n",
+                cache->run.hits, cache->run.misses, cache->run.stores, cache->run.evictions);
+
+    for (i = 0; i < threads; i++)
+        pthread_mutex_destroy(&pool.queues[i].lock);
+    for (i = 0; i < files.count; i++)
+        free(files.path[i]);
+    free(files.path);
+    free(pool.results);
+    free(pool.queues);
+    free(workers);
+    free(handles);
+    return failed;
+}
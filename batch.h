@@ -0,0 +1,23 @@
+#ifndef BATCH_H_INCLUDED
+#define BATCH_H_INCLUDED
+
+#include <stdio.h>
+#include "cache.h"
+
+/**
+ *  Compiles a whole tree of programs at once, on a pool of threads.
+ *
+ *  Each path may be a directory, which is searched (subdirectories too) for
+ *  .pl0 files, a .pl0 file, or a list file naming one path per line. Every
+ *  program that compiles gets its .pm0 written next to it. Once they are all
+ *  done, one line per file goes to report, in path order: PASS or FAIL, how
+ *  long it took and the first error, followed by the totals.
+ *
+ *  threads <= 0 means one per core. If binary is 1 the programs are written
+ *  as PM0B, to .pm0b files. If cache isn't NULL, a program found in
+ *  it is copied out instead of compiled, and every program compiled goes
+ *  into it. Returns the number of files that failed.
+ */
+int batchCompile(char **paths, int count, int threads, int binary, pl0Cache *cache, FILE *report);
+
+#endif // BATCH_H_INCLUDED
@@ -0,0 +1,401 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <utime.h>
+#else
+#include <direct.h>
+#include <process.h>
+#include <sys/utime.h>
+#define getpid _getpid
+#endif
+#include "cache.h"
+
+#define CACHE_STALE_SECONDS 3600    // A temporary file this old belongs to a compiler that died, it can go
+
+/**
+ *  An entry in the cache directory, for working out which to evict.
+ */
+typedef struct cacheEntry
+{
+    char *path;
+    time_t used;            // Its modification time, touched on every hit
+    long long size;
+} cacheEntry;
+
+static void hashBytes(unsigned long long *hash, const void *data, size_t len);
+static char *entryPath(pl0Cache *cache, const char *name);
+static void loadStats(pl0Cache *cache, pl0CacheStats *stats);
+static long long scanEntries(pl0Cache *cache, long long target);
+static int compareUsed(const void *a, const void *b);
+static int writeIdentity(FILE *out, const pl0CacheKey *key);
+static int matchIdentity(FILE *in, const pl0CacheKey *key);
+static int copyRest(FILE *in, FILE *out);
+
+int cacheOpen(pl0Cache *cache, const char *dir, long long maxBytes)
+{
+    struct stat info;
+
+    memset(cache, 0, sizeof(pl0Cache));
+#ifndef _WIN32
+    mkdir(dir, 0777);                               // Fails if it's already there, which is fine
+#else
+    _mkdir(dir);
+#endif
+    if (stat(dir, &info) != 0 || !S_ISDIR(info.st_mode))
+        return 1;
+    cache->dir = malloc(strlen(dir) + 1);
+    if (cache->dir == NULL)
+        return 1;
+    strcpy(cache->dir, dir);
+    cache->maxBytes = maxBytes;
+    pthread_mutex_init(&cache->lock, NULL);
+    loadStats(cache, &cache->saved);
+    cache->bytes = scanEntries(cache, -1);
+    if (cache->bytes > cache->maxBytes)             // Opened with a smaller size than it was filled to
+        cache->bytes = scanEntries(cache, cache->maxBytes - cache->maxBytes / 10);
+    return 0;
+}
+
+void cacheKey(pl0CacheKey *key, const char *src, size_t len, const pl0Options *options, int binary)
+{
+    unsigned long long hash = 14695981039346656037ULL;         // FNV-1a offset basis
+
+    memset(key->knobs, 0, sizeof(key->knobs));
+    key->knobs[5] = PL0_INLINE_LIMIT;
+    if (options != NULL)                            // Only what changes the code, lexThreads doesn't
+    {
+        key->knobs[0] = options->noFold;
+        key->knobs[1] = options->noPeephole;
+        key->knobs[2] = options->classic;
+        key->knobs[3] = options->noPrune;
+        key->knobs[4] = options->noInline;
+        if (options->inlineLimit > 0)               // The limit it compiles with, 0 and PL0_INLINE_LIMIT are the same
+            key->knobs[5] = options->inlineLimit;
+    }
+    key->knobs[6] = binary;
+    key->src = src;
+    key->length = len;
+    hashBytes(&hash, PL0_VERSION, strlen(PL0_VERSION) + 1);
+    hashBytes(&hash, key->knobs, sizeof(key->knobs));
+    hashBytes(&hash, &len, sizeof(len));
+    hashBytes(&hash, src, len);
+    sprintf(key->name, "%016llx", hash);
+}
+
+int cacheFetch(pl0Cache *cache, const pl0CacheKey *key, const char *outName)
+{
+    char name[CACHE_KEY_LENGTH + 5];
+    char *path;
+    FILE *in, *out;
+    int hit = 0;
+
+    sprintf(name, "%s.pm0", key->name);
+    path = entryPath(cache, name);
+    in = path ? fopen(path, "rb") : NULL;
+    if (in != NULL && matchIdentity(in, key))       // Not just the same hash, the same program
+    {
+        out = fopen(outName, "wb");
+        hit = out != NULL && copyRest(in, out) == 0;
+        if (out != NULL)
+            hit &= fclose(out) == 0;
+    }
+    if (in != NULL)
+        fclose(in);
+    if (hit)
+        utime(path, NULL);                          // Used just now, it's the last to be evicted
+    free(path);
+
+    pthread_mutex_lock(&cache->lock);
+    if (hit)
+        cache->run.hits++;
+    else
+        cache->run.misses++;
+    pthread_mutex_unlock(&cache->lock);
+    return hit;
+}
+
+void cacheStore(pl0Cache *cache, const pl0CacheKey *key, const char *outName)
+{
+    char name[CACHE_KEY_LENGTH + 40];
+    char *temp, *path;
+    struct stat info;
+    FILE *in, *out;
+    int sequence, failed;
+
+    pthread_mutex_lock(&cache->lock);
+    sequence = cache->sequence++;
+    pthread_mutex_unlock(&cache->lock);
+
+    sprintf(name, "%s.tmp.%d.%d", key->name, (int)getpid(), sequence);   // Nobody else writes to this one
+    temp = entryPath(cache, name);
+    sprintf(name, "%s.pm0", key->name);
+    path = entryPath(cache, name);
+    if (temp == NULL || path == NULL)
+    {
+        free(temp);
+        free(path);
+        return;
+    }
+    in = fopen(outName, "rb");
+    out = fopen(temp, "wb");
+    failed = in == NULL || out == NULL || writeIdentity(out, key) || copyRest(in, out);
+    if (in != NULL)
+        fclose(in);
+    if (out != NULL)
+        failed |= fclose(out) != 0;
+#ifdef _WIN32
+    if (!failed)
+        remove(path);                               // Windows won't rename over a file. Someone else stored the same program, it's the same either way
+#endif
+    if (failed || rename(temp, path) != 0)
+    {
+        remove(temp);
+        free(temp);
+        free(path);
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    cache->run.stores++;
+    if (stat(path, &info) == 0)
+        cache->bytes += info.st_size;
+    if (cache->bytes > cache->maxBytes)             // Down to 90%, so we aren't back here on the very next store
+        cache->bytes = scanEntries(cache, cache->maxBytes - cache->maxBytes / 10);
+    pthread_mutex_unlock(&cache->lock);
+    free(temp);
+    free(path);
+}
+
+void cacheClose(pl0Cache *cache)
+{
+    pl0CacheStats now;
+    char *temp, *path;
+    char name[40];
+    FILE *out;
+
+    if (cache->dir == NULL)
+        return;
+    loadStats(cache, &now);                         // Someone else may have added to it since we opened it
+    now.hits += cache->run.hits;
+    now.misses += cache->run.misses;
+    now.stores += cache->run.stores;
+    now.evictions += cache->run.evictions;
+
+    sprintf(name, "stats.tmp.%d", (int)getpid());
+    temp = entryPath(cache, name);
+    path = entryPath(cache, "stats");
+    out = temp ? fopen(temp, "w") : NULL;
+    if (out != NULL)
+    {
+        fprintf(out, "%lld hits\n%lld misses\n%lld stores\n%lld evictions\n", now.hits, now.misses, now.stores, now.evictions);
+        if (fclose(out) == 0)
+        {
+#ifdef _WIN32
+            remove(path);
+#endif
+            if (rename(temp, path) == 0)
+                cache->saved = now;
+        }
+        remove(temp);                               // Only still there if something went wrong
+    }
+    free(temp);
+    free(path);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->dir);
+    cache->dir = NULL;
+}
+
+/**
+ *  FNV-1a, a byte at a time.
+ */
+static void hashBytes(unsigned long long *hash, const void *data, size_t len)
+{
+    const unsigned char *bytes = data;
+    unsigned long long h = *hash;
+    size_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;                      // FNV prime
+    }
+    *hash = h;
+}
+
+static char *entryPath(pl0Cache *cache, const char *name)
+{
+    char *path = malloc(strlen(cache->dir) + strlen(name) + 2);
+    if (path != NULL)
+        sprintf(path, "%s/%s", cache->dir, name);
+    return path;
+}
+
+static void loadStats(pl0Cache *cache, pl0CacheStats *stats)
+{
+    char *path = entryPath(cache, "stats");
+    FILE *in = path ? fopen(path, "r") : NULL;
+
+    memset(stats, 0, sizeof(pl0CacheStats));
+    if (in != NULL)
+    {
+        if (fscanf(in, "%lld hits %lld misses %lld stores %lld evictions", &stats->hits, &stats->misses, &stats->stores, &stats->evictions) != 4)
+            memset(stats, 0, sizeof(pl0CacheStats));    // Not ours, or half written by hand. Start counting again
+        fclose(in);
+    }
+    free(path);
+}
+
+/**
+ *  Adds up the entries in the cache and, if target isn't -1, deletes the
+ *  ones used longest ago until they add up to no more than target. Also
+ *  clears out temporary files that have been lying around too long.
+ *  Returns what the entries left add up to.
+ */
+static long long scanEntries(pl0Cache *cache, long long target)
+{
+    DIR *dir = opendir(cache->dir);
+    struct dirent *entry;
+    struct stat info;
+    cacheEntry *entries = NULL, *grown;
+    int count = 0, capacity = 0, i;
+    long long total = 0;
+    time_t now = time(NULL);
+    char *path;
+    size_t length;
+
+    if (dir == NULL)
+        return 0;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        length = strlen(entry->d_name);
+        if (length < 4 || entry->d_name[0] == '.')
+            continue;
+        path = entryPath(cache, entry->d_name);
+        if (path == NULL || stat(path, &info) != 0 || !S_ISREG(info.st_mode))
+        {
+            free(path);
+            continue;
+        }
+        if (strstr(entry->d_name, ".tmp.") != NULL)
+        {
+            if (now - info.st_mtime > CACHE_STALE_SECONDS)
+                remove(path);
+            free(path);
+            continue;
+        }
+        if (strcmp(entry->d_name + length - 4, ".pm0") != 0)
+        {
+            free(path);                             // The stats file, or something that isn't ours
+            continue;
+        }
+        total += info.st_size;
+        if (target < 0)
+        {
+            free(path);
+            continue;
+        }
+        if (count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 256;
+            grown = realloc(entries, capacity * sizeof(cacheEntry));
+            if (grown == NULL)
+            {
+                free(path);
+                break;                              // Evict from what we have so far
+            }
+            entries = grown;
+        }
+        entries[count].path = path;
+        entries[count].used = info.st_mtime;
+        entries[count].size = info.st_size;
+        count++;
+    }
+    closedir(dir);
+
+    if (count > 1)
+        qsort(entries, count, sizeof(cacheEntry), compareUsed);
+    for (i = 0; i < count; i++)
+    {
+        if (total > target && remove(entries[i].path) == 0)
+        {
+            total -= entries[i].size;
+            cache->run.evictions++;
+        }
+        free(entries[i].path);
+    }
+    free(entries);
+    return total;
+}
+
+static int compareUsed(const void *a, const void *b)
+{
+    const cacheEntry *x = a, *y = b;
+    return (x->used > y->used) - (x->used < y->used);
+}
+
+/**
+ *  Writes what an entry has to match before its program: the version,
+ *  the knobs, the source's length and the source. Returns 0 on success.
+ */
+static int writeIdentity(FILE *out, const pl0CacheKey *key)
+{
+    long long length = key->length;
+
+    fwrite(PL0_VERSION, 1, strlen(PL0_VERSION) + 1, out);
+    fwrite(key->knobs, sizeof(key->knobs), 1, out);
+    fwrite(&length, sizeof(length), 1, out);
+    fwrite(key->src, 1, key->length, out);
+    return ferror(out) != 0;
+}
+
+/**
+ *  Reads what writeIdentity wrote and returns 1 if it is key's, leaving in
+ *  at the start of the program. An entry from before there was one, or a
+ *  different program with the same hash, returns 0.
+ */
+static int matchIdentity(FILE *in, const pl0CacheKey *key)
+{
+    char buffer[65536];
+    size_t versionLength = strlen(PL0_VERSION) + 1, at, part;
+    int knobs[7];
+    long long length;
+
+    if (fread(buffer, 1, versionLength, in) != versionLength || memcmp(buffer, PL0_VERSION, versionLength) != 0)
+        return 0;
+    if (fread(knobs, sizeof(knobs), 1, in) != 1 || memcmp(knobs, key->knobs, sizeof(knobs)) != 0)
+        return 0;
+    if (fread(&length, sizeof(length), 1, in) != 1 || length != (long long)key->length)
+        return 0;
+    for (at = 0; at < key->length; at += part)
+    {
+        part = key->length - at < sizeof(buffer) ? key->length - at : sizeof(buffer);
+        if (fread(buffer, 1, part, in) != part || memcmp(buffer, key->src + at, part) != 0)
+            return 0;
+    }
+    return 1;
+}
+
+/**
+ *  Copies the rest of in to out, returns 0 on success. out may be left
+ *  half written if it fails.
+ */
+static int copyRest(FILE *in, FILE *out)
+{
+    char buffer[65536];
+    size_t got;
+    int failed = 0;
+
+    while ((got = fread(buffer, 1, sizeof(buffer), in)) > 0)
+    {
+        if (fwrite(buffer, 1, got, out) != got)
+            failed = 1;
+    }
+    failed |= ferror(in) != 0;
+    return failed | (ferror(out) != 0);
+}
@@ -0,0 +1,67 @@
+#ifndef CACHE_H_INCLUDED
+#define CACHE_H_INCLUDED
+
+#include <pthread.h>
+#include "compiler.h"
+
+/**
+ *  A cache of compiled programs on disk, so a program nobody has changed
+ *  is never compiled twice.
+ *
+ *  A program is filed under a hash of everything that decides what it
+ *  compiles to: the compiler's version, the options that change the code,
+ *  whether it was written as text or PM0B, and the source itself. Finding it
+ *  needs nothing but the source, so a hit skips lexing and parsing
+ *  altogether and just copies the file out.
+ *
+ *  The hash only names the file. An entry starts with everything that went
+ *  into the hash and a fetch compares all of it, source included, so two
+ *  programs that happen to hash alike never get each other's code.
+ *
+ *  Entries are written to a temporary file and renamed into place, so
+ *  nobody sharing the directory ever reads half of one. Every hit touches
+ *  its entry, and once the entries add up to more than maxBytes the ones
+ *  used longest ago are deleted until they fit again.
+ *
+ *  One cache can be shared by all the threads of a batch.
+ */
+#define CACHE_KEY_LENGTH 16     // Hex digits in a key
+
+/**
+ *  What a program is filed under. It points into the source, which has to
+ *  stay put until the cache is done with the key.
+ */
+typedef struct pl0CacheKey
+{
+    char name[CACHE_KEY_LENGTH + 1];    // The hash, the entry's file name
+    int knobs[7];           // The options that change the code, and whether it's PM0B
+    const char *src;
+    size_t length;
+} pl0CacheKey;
+
+typedef struct pl0CacheStats
+{
+    long long hits;         // Programs found in the cache
+    long long misses;       // Programs that had to be compiled
+    long long stores;       // Programs added to the cache
+    long long evictions;    // Programs deleted to make room
+} pl0CacheStats;
+
+typedef struct pl0Cache
+{
+    char *dir;
+    long long maxBytes;     // Evict once the entries add up to more than this
+    long long bytes;        // What the entries add up to, as far as we know. Others sharing the directory add to it too
+    pl0CacheStats run;      // Since cacheOpen
+    pl0CacheStats saved;    // Every run before this one, as the stats file had it when we opened the cache
+    int sequence;           // Numbers our temporary files
+    pthread_mutex_t lock;
+} pl0Cache;
+
+int cacheOpen(pl0Cache *cache, const char *dir, long long maxBytes);    // Makes dir if it has to, returns 0 on success
+void cacheKey(pl0CacheKey *key, const char *src, size_t len, const pl0Options *options, int binary);     // Works out what the program is filed under
+int cacheFetch(pl0Cache *cache, const pl0CacheKey *key, const char *outName);  // Writes the cached program to outName, returns 1 on a hit and 0 on a miss
+void cacheStore(pl0Cache *cache, const pl0CacheKey *key, const char *outName); // Files the program just written to outName under key
+void cacheClose(pl0Cache *cache);                                       // Adds this run to the stats file and releases the cache
+
+#endif // CACHE_H_INCLUDED
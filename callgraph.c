@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include "ast.h"
+
+/**
+ *  Dead procedure elimination, on the syntax tree before any code is
+ *  generated for it.
+ *
+ *  The call graph comes straight off the tree: a procedure calls every
+ *  procedure named by a call statement in its body. Starting from the main
+ *  block's statement we follow calls to everything that can ever run, and
+ *  any procedure we didn't get to is unlinked from its block, along with
+ *  every procedure declared inside it. Their symbols get addr -1, so
+ *  nothing mistakes them for code that exists.
+ *
+ *  It runs after folding, so a call in a branch that folding took out
+ *  doesn't keep its procedure alive.
+ */
+typedef struct callGraph
+{
+    astNode **blocks;       // Each procedure's block, by symbol index. NULL for other symbols
+    char *reached;          // 1 once a call to the procedure has been found
+    int *work;              // Procedures reached whose bodies we haven't looked through yet
+    int count;              // Number of them
+} callGraph;
+
+static void findProcedures(astNode *block, astNode **blocks);
+static void findCalls(astNode *statement, callGraph *graph);
+static int unlinkDead(astNode *block, symbol *symbols, char *reached);
+static int markDead(astNode *procedure, symbol *symbols);
+
+int pruneProcedures(astNode *program, symbol *symbols, int symbolCount)
+{
+    callGraph graph;
+    int dead = 0, procedure;
+
+    graph.blocks = calloc(symbolCount + 1, sizeof(astNode *));
+    graph.reached = calloc(symbolCount + 1, 1);
+    graph.work = malloc((symbolCount + 1) * sizeof(int));
+    graph.count = 0;
+    if (graph.blocks != NULL && graph.reached != NULL && graph.work != NULL)  //Otherwise leave the program as it is
+    {
+        findProcedures(program, graph.blocks);
+        findCalls(program->kid[1], &graph);
+        while (graph.count > 0)
+        {
+            procedure = graph.work[--graph.count];
+            findCalls(graph.blocks[procedure]->kid[1], &graph);
+        }
+        dead = unlinkDead(program, symbols, graph.reached);
+    }
+    free(graph.blocks);
+    free(graph.reached);
+    free(graph.work);
+    return dead;
+}
+
+static void findProcedures(astNode *block, astNode **blocks)
+{
+    astNode *procedure;
+
+    for (procedure = block->kid[0]; procedure != NULL; procedure = procedure->next)
+    {
+        blocks[procedure->value] = procedure->kid[0];
+        findProcedures(procedure->kid[0], blocks);
+    }
+}
+
+static void findCalls(astNode *statement, callGraph *graph)
+{
+    astNode *inner;
+
+    switch (statement->kind)
+    {
+        case AST_CALL   : if (!graph->reached[statement->value])
+                          {
+                              graph->reached[statement->value] = 1;
+                              graph->work[graph->count++] = statement->value;   //Each procedure goes on once, so work never holds more than every symbol
+                          }
+                          break;
+        case AST_BEGIN  : for (inner = statement->kid[0]; inner != NULL; inner = inner->next)
+                              findCalls(inner, graph);
+                          break;
+        case AST_IF     : findCalls(statement->kid[1], graph);
+                          if (statement->kid[2] != NULL)
+                              findCalls(statement->kid[2], graph);
+                          break;
+        case AST_WHILE  : findCalls(statement->kid[1], graph);
+                          break;
+        default         : break;
+    }
+}
+
+/**
+ *  Unlinks the procedures of block that were never reached, and the ones
+ *  inside those that were. Returns how many procedures went.
+ */
+static int unlinkDead(astNode *block, symbol *symbols, char *reached)
+{
+    astNode **link = &block->kid[0];
+    int dead = 0;
+
+    while (*link != NULL)
+    {
+        if (reached[(*link)->value])
+        {
+            dead += unlinkDead((*link)->kid[0], symbols, reached);
+            link = &(*link)->next;
+        } else
+        {
+            dead += markDead(*link, symbols);
+            *link = (*link)->next;
+        }
+    }
+    return dead;
+}
+
+static int markDead(astNode *procedure, symbol *symbols)
+{
+    astNode *inner;
+    int dead = 1;
+
+    symbols[procedure->value].addr = -1;
+    for (inner = procedure->kid[0]->kid[0]; inner != NULL; inner = inner->next)
+        dead += markDead(inner, symbols);
+    return dead;
+}
@@ -0,0 +1,219 @@
+#include <stdlib.h>
+#include "ast.h"
+
+/**
+ *  Walks the syntax tree and barks out the PM/0 for it. The instructions and
+ *  their order are exactly what the parser used to bark as it went, so
+ *  jumps are still barked as placeholders and rebarked once we know where
+ *  they go.
+ *
+ *  level is the lex level of the code being generated, the program's block
+ *  is at 0 and a procedure's body is at the level of its symbol.
+ *
+ *  Unless out->classic is set, conditions and expressions use the fused
+ *  instructions of the extended ISA (see compiler.h): a comparison and the
+ *  jump on it are one J<rel>, and an operator whose right operand is a
+ *  variable or a number takes it straight from there instead of having it
+ *  pushed first.
+ *
+ *  With the extended ISA a while loop is also rotated: the condition is
+ *  tested once on the way in, jumping past the loop if it's false, and
+ *  again after the body, jumping back to the top if it's true. Each trip
+ *  round then costs one branch instead of the test at the top and the JMP
+ *  back at the bottom.
+ */
+static void genBlock(codeBuffer *out, symbol *symbols, astNode *block, int level);
+static void genStatement(codeBuffer *out, symbol *symbols, astNode *statement, int level);
+static void genExpression(codeBuffer *out, symbol *symbols, astNode *expression, int level);
+static int genBranch(codeBuffer *out, symbol *symbols, astNode *condition, int level);  //Barks the condition and a jump taken when it's false, returns where the jump is
+static void genBranchBack(codeBuffer *out, symbol *symbols, astNode *condition, int level, int target);  //Barks the condition and a jump to target taken when it's true
+static void bark(codeBuffer *out, int op, int l, int m);    //Barks out command
+static void rebark(codeBuffer *out, int addr, int m);       //Updates command with new modifier
+
+int generateCode(astNode *program, symbol *symbols, codeBuffer *out)
+{
+    genBlock(out, symbols, program, 0);
+    bark(out, 9, 0, 2);                                     //Halt at the end of the program
+    return out->failed;
+}
+
+static void genBlock(codeBuffer *out, symbol *symbols, astNode *block, int level)
+{
+    astNode *procedure;
+    int temp;
+
+    temp = out->count;                                      //We need to jump past the child procedures to the body of the function
+    bark(out, 7, 0, 0);                                     //Placeholder jump command
+
+    for (procedure = block->kid[0]; procedure != NULL; procedure = procedure->next)
+    {
+        symbols[procedure->value].addr = out->count;        //The procedure starts here, with its own jump past its children
+        genBlock(out, symbols, procedure->kid[0], symbols[procedure->value].level);
+    }
+
+    rebark(out, temp, out->count);                          //Correct or previous barked jump
+    bark(out, 6, 0, block->value);                          //Set up our stack frame with room for all of our variables
+
+    genStatement(out, symbols, block->kid[1], level);
+    if (level > 0)                                          //If we're not in the bottom lex level
+        bark(out, 2, 0, 0);                                 //We need to return from the procedure
+}
+
+static void genStatement(codeBuffer *out, symbol *symbols, astNode *statement, int level)
+{
+    symbol *sym = NULL;
+    astNode *inner;
+    int save, save2;
+
+    if (statement->kind == AST_ASSIGN || statement->kind == AST_CALL || statement->kind == AST_READ || statement->kind == AST_WRITE)
+        sym = &symbols[statement->value];
+    switch (statement->kind)
+    {
+        case AST_ASSIGN : genExpression(out, symbols, statement->kid[0], level);
+                          bark(out, 4, level - sym->level, sym->addr);  //Store the top of the stack into the variable
+                          break;
+        case AST_CALL   : bark(out, 5, level + 1 - sym->level, sym->addr);
+                          break;
+        case AST_BEGIN  : for (inner = statement->kid[0]; inner != NULL; inner = inner->next)
+                              genStatement(out, symbols, inner, level);
+                          break;
+        case AST_IF     : save = genBranch(out, symbols, statement->kid[0], level);    //Save the jump's position so we can rebark it later
+                          genStatement(out, symbols, statement->kid[1], level);
+                          if (statement->kid[2] != NULL)
+                          {
+                              save2 = out->count;   //Save position of the jump to skip the else
+                              bark(out, 7, 0, 0);   //If we hit this jump, the above condition was true and we do not want to do the else code
+                              rebark(out, save, out->count);    //If the condition was false, we wish to jump here now
+                              genStatement(out, symbols, statement->kid[2], level);
+                              rebark(out, save2, out->count);   //If we jumped past the else, this is where we will end up.
+                          }else
+                          {
+                              rebark(out, save, out->count);    //Update the mod of our jump command to go to the next instruction after the body of the then.
+                          }
+                          break;
+        case AST_WHILE  : save2 = out->count;
+                          if (statement->kid[0]->kind == AST_NUMBER)    //Folded to true, nothing to test
+                          {
+                              genStatement(out, symbols, statement->kid[1], level);
+                              bark(out, 7, 0, save2);
+                              break;
+                          }
+                          save = genBranch(out, symbols, statement->kid[0], level);    //Save the jump's position so we can rebark it later
+                          if (!out->classic)        //Rotated, the test at the bottom jumps back while it holds
+                          {
+                              save2 = out->count;
+                              genStatement(out, symbols, statement->kid[1], level);
+                              genBranchBack(out, symbols, statement->kid[0], level, save2);
+                              rebark(out, save, out->count);
+                              break;
+                          }
+                          genStatement(out, symbols, statement->kid[1], level);
+                          bark(out, 7, 0, save2);
+                          rebark(out, save, out->count);    //Update the mod of our jump command to go to the next instruction after the body of the loop.
+                          break;
+        case AST_READ   : bark(out, 9, 0, 1);       //Bark out a read from user input command
+                          bark(out, 4, level - sym->level, sym->addr);  //Store the value read in to the variable
+                          break;
+        case AST_WRITE  : if (sym->kind == 1)       //Put the value on the stack, then write it out
+                              bark(out, 1, 0, sym->val);
+                          else
+                              bark(out, 3, level - sym->level, sym->addr);
+                          bark(out, 9, 0, 0);
+                          break;
+        default         : break;
+    }
+}
+
+static void genExpression(codeBuffer *out, symbol *symbols, astNode *expression, int level)
+{
+    symbol *sym;
+
+    switch (expression->kind)
+    {
+        case AST_NUMBER  : bark(out, 1, 0, expression->value);
+                           break;
+        case AST_IDENT   : sym = &symbols[expression->value];
+                           if (sym->kind == 1)      //If it's a constant put the value on the stack
+                               bark(out, 1, 0, sym->val);
+                           else                     //Otherwise load the variable from the frame level - sym->level back
+                               bark(out, 3, level - sym->level, sym->addr);
+                           break;
+        case AST_NEGATE  : genExpression(out, symbols, expression->kid[0], level);
+                           bark(out, 2, 0, 1);
+                           break;
+        case AST_ODD     : genExpression(out, symbols, expression->kid[0], level);
+                           bark(out, 2, 0, 6);
+                           break;
+        case AST_BINARY  : if (!out->classic && (expression->kid[1]->kind == AST_NUMBER || expression->kid[1]->kind == AST_IDENT))
+                           {
+                               genExpression(out, symbols, expression->kid[0], level);
+                               if (expression->kid[1]->kind == AST_NUMBER)              //IADD ISUB IMUL IDIV
+                                   bark(out, 18 + expression->op, 0, expression->kid[1]->value);
+                               else if ((sym = &symbols[expression->kid[1]->value])->kind == 1)
+                                   bark(out, 18 + expression->op, 0, sym->val);
+                               else                                                     //LADD LSUB LMUL LDIV
+                                   bark(out, 14 + expression->op, level - sym->level, sym->addr);
+                               break;
+                           }
+                           //Falls through - any other operation is generated like a comparison
+        case AST_COMPARE : genExpression(out, symbols, expression->kid[0], level);
+                           genExpression(out, symbols, expression->kid[1], level);
+                           bark(out, 2, 0, expression->op);
+                           break;
+    }
+}
+
+static int genBranch(codeBuffer *out, symbol *symbols, astNode *condition, int level)
+{
+    static const int unless[6] = {11, 10, 15, 14, 13, 12};    //The J<rel> that jumps when OPR 8 to 13 would give 0: JNE JEQ JGE JGT JLE JLT
+
+    if (!out->classic && condition->kind == AST_COMPARE)
+    {
+        genExpression(out, symbols, condition->kid[0], level);
+        genExpression(out, symbols, condition->kid[1], level);
+        bark(out, unless[condition->op - 8], 0, 0);
+        return out->count - 1;
+    }
+    genExpression(out, symbols, condition, level);
+    bark(out, 8, 0, 0);                                     //Bark out a jump if condition resolved to 0
+    return out->count - 1;
+}
+
+static void genBranchBack(codeBuffer *out, symbol *symbols, astNode *condition, int level, int target)
+{
+    if (condition->kind == AST_COMPARE)
+    {
+        genExpression(out, symbols, condition->kid[0], level);
+        genExpression(out, symbols, condition->kid[1], level);
+        bark(out, condition->op + 2, 0, target);            //J<rel> for OPR 8 to 13 is 10 to 15
+        return;
+    }
+    genExpression(out, symbols, condition, level);
+    bark(out, 24, 0, target);                               //JNZ
+}
+
+static void bark(codeBuffer *out, int op, int l, int m)
+{
+    if (out->count == out->capacity)                        //No room left for the instruction, double the program
+    {
+        int cap = out->capacity ? out->capacity * 2 : 512;
+        command *grown = realloc(out->code, cap * sizeof(command));
+        if (grown == NULL)
+        {
+            out->failed = 1;                                //Keep going without it, the caller will throw the program away
+            return;
+        }
+        out->code = grown;
+        out->capacity = cap;
+    }
+    out->code[out->count].op = op;
+    out->code[out->count].lex = l;
+    out->code[out->count].mod = m;
+    out->count++;
+}
+
+static void rebark(codeBuffer *out, int addr, int m)
+{
+    if (addr < out->count)
+        out->code[addr].mod = m;
+}
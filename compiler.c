@@ -0,0 +1,866 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <setjmp.h>
+#include <time.h>
+#include "lexer.h"
+#include "compiler.h"
+#include "arena.h"
+#include "ast.h"
+#include "pm0b.h"
+
+typedef struct token
+{
+    int idNum;
+    int name;           // name id of an identsym, -1 otherwise
+    int value;
+    const char *text;   // Where the token is spelled in the source, for error messages
+    int length;
+} token;
+
+static const char symbolName[34][13] = {"", "nulsym", "identsym", "numbersym", "plussym", "minussym", "multsym", "slashsym", "oddsym", "eqlsym", "neqsym", "lessym", "leqsym", "gtrsym", "geqsym", "lparentsym",
+                                 "rparentsym", "commasym", "semicolonsym", "periodsym", "becomessym", "beginsym", "endsym", "ifsym", "thensym", "whilesym", "dosym", "callsym", "constsym", "varsym",
+                                 "procsym", "writesym", "readsym", "elsesym"};
+
+/**
+ *  Everything one compile works on. Each call to pl0_compile has its own, so
+ *  compiles running side by side never see each other.
+ *
+ *  pos is the current position for the end of the scope
+ *  frameSize determines where new variables will be stored in the stack as well as the size of the stack
+ *  tokenNum is the token number of the current token. Used to tell the user where there is a problem
+ *  lexLev is the current lexicographical level we are in
+ *  tok is the current token being parsed
+ *      It is filled from tokens[tokenNum-1] every time we consume
+ *  source is the whole input program, borrowed from the caller
+ *  tokens is every token in source, lexed before parsing starts
+ *
+ *  symbolTable is every constant, variable and procedure the program declares,
+ *  in the order they were declared. The syntax tree refers to them by index.
+ *  scope is the indices of the ones we can see from where the parser is, the
+ *  innermost declarations on top.
+ *
+ *  varHead and procHead say, for each name id from the lexer, which symbol that
+ *  name means right now, or -1 if it means nothing. Constants and variables
+ *  share varHead, procedures have procHead to themselves. Every symbol keeps
+ *  in shadow whatever its name meant before it was declared, so when a
+ *  procedure ends, popping its symbols off the scope puts the outer names back.
+ *
+ *  nodes is where the syntax tree lives, all of it is freed at once at the end
+ *
+ *  entries is where each procedure's code starts, in the order of out's
+ *  procedure table, for the peephole pass to keep up to date
+ *
+ *  out is where errors are reported, and bailOut is where they jump back to in pl0_compile
+ */
+typedef struct compiler
+{
+    int pos, frameSize, tokenNum, lexLev;
+    token tok;
+    lexSource source;
+    tokenStream tokens;
+    symbol *symbolTable;
+    int symbolCount, symbolCap;
+    int *scope;
+    int *varHead, *procHead;
+    arena nodes;
+    int *entries;
+    pl0Program *out;
+    jmp_buf bailOut;
+} compiler;
+
+/**
+ *  Non-Terminal Symbols
+ *  Used in Tiny PL0 Grammar
+ *  Each returns the piece of syntax tree it parsed
+ */
+static astNode *program(compiler *c);
+static astNode *block(compiler *c);
+static void constDec(compiler *c);
+static void varDec(compiler *c);
+static astNode *statement(compiler *c);
+static astNode *condition(compiler *c);
+static astNode *expression(compiler *c);
+static astNode *term(compiler *c);
+static astNode *factor(compiler *c);
+/**
+ *  New Non-Terminal Symbols
+ *  Used in PL0 Grammar
+ */
+static astNode *procDec(compiler *c);
+
+/**
+ *  These provide functionality to our compiler
+ *
+ */
+static void consume(compiler *c, int last);             //Consumes the old token, and gets a new one. Will complain if it gets heartburn (unexpected token)
+static astNode *newNode(compiler *c, int kind);         //Makes a zeroed tree node in the arena
+static int ident(compiler *c, int kind);                //Adds ident to symbol table, returns its index
+static int getIdent(compiler *c, int name);             //Finds the constant or variable a name means, returns its index
+static int storeIdent(compiler *c, int name);           //Finds the variable a name means, complains if it's a constant
+/**
+ *  New functions
+ *
+ */
+static int callIdent(compiler *c);                      //Finds the procedure being called and consumes its name
+static void leaveScope(compiler *c, int mark);          //Pops the scope back down to mark, unhiding any names the popped symbols hid
+static void report(compiler *c, const char *format, ...);   //Adds to the error message, printf style
+static _Noreturn void bail(compiler *c);                //Gives up on the program and goes back to pl0_compile
+static double nowMs();                                  //A clock in milliseconds, for timing the stages
+static int listProcedures(compiler *c, codeBuffer *code);   //Fills in out's procedure table, returns 1 if it ran out of memory
+
+
+int pl0_compile(const char *src, size_t len, const pl0Options *options, pl0Program *out)
+{
+    compiler *c = calloc(1, sizeof(compiler));          //Zeroed, so everything starts out empty
+    codeBuffer code = {NULL, 0, 0, 0, 0};
+    astNode *root;
+    double started, lexed, parsed;
+    int i;
+
+    memset(out, 0, sizeof(pl0Program));
+    if (c == NULL)
+    {
+        out->failed = 1;
+        strcpy(out->message, "Out of memory\n");
+        return 1;
+    }
+    c->frameSize = 4;
+    c->out = out;
+    borrowSource(&c->source, src, len);
+
+    if (setjmp(c->bailOut) == 0)
+    {
+        started = nowMs();
+        tokenizeParallel(&c->source, &c->tokens, options ? options->lexThreads : 0);   //Lex everything up front. If it failed we'll report it when the parser gets there
+        lexed = nowMs();
+        if (c->tokens.failed == 2)                      //Out of memory isn't the source's fault, say so now rather than at the token
+        {
+            report(c, "%s", c->source.error);
+            bail(c);
+        }
+
+        c->varHead = malloc((c->tokens.names.count + 1) * sizeof(int));   //Every name the program uses is known now, and means nothing yet
+        c->procHead = malloc((c->tokens.names.count + 1) * sizeof(int));
+        if (c->varHead == NULL || c->procHead == NULL)
+        {
+            report(c, "Out of memory\n");
+            bail(c);
+        }
+        memset(c->varHead, -1, (c->tokens.names.count + 1) * sizeof(int));
+        memset(c->procHead, -1, (c->tokens.names.count + 1) * sizeof(int));
+
+        c->tok.idNum = 1;
+        consume(c, nulsym);
+
+        root = program(c);
+        parsed = nowMs();
+
+        if (options == NULL || !options->noFold)
+            foldConstants(root, c->symbolTable);
+        if (options == NULL || !options->noInline)
+            out->inlinedCalls = inlineCalls(root, &c->symbolTable, &c->symbolCount, &c->symbolCap, &c->nodes,
+                                            options != NULL && options->inlineLimit > 0 ? options->inlineLimit : PL0_INLINE_LIMIT);
+        if (options == NULL || !options->noPrune)
+            out->deadProcedures = pruneProcedures(root, c->symbolTable, c->symbolCount);
+        code.classic = options != NULL && options->classic;
+
+        if (generateCode(root, c->symbolTable, &code))
+        {
+            report(c, "Out of memory, program too long\n");
+            bail(c);
+        }
+        out->generatedLength = code.count;
+        if (listProcedures(c, &code))
+        {
+            report(c, "Out of memory\n");
+            bail(c);
+        }
+        if (options == NULL || !options->noPeephole)
+            peephole(&code, c->entries, out->procedureCount);
+        for (i = 0; i < out->procedureCount; i++)
+            out->procedures[i].entry = c->entries[i];
+
+        out->lexMs = lexed - started;
+        out->parseMs = parsed - lexed;
+        out->genMs = nowMs() - parsed;
+        out->code = code.code;                          //The program is the caller's now
+        out->length = code.count;
+        code.code = NULL;
+    } else                                              //Something called bail, the message is already in out
+    {
+        free(out->procedures);
+        out->procedures = NULL;
+        out->procedureCount = 0;
+        out->failed = 1;
+        out->errorToken = c->tokenNum;
+        out->errorOffset = c->tok.text ? (size_t)(c->tok.text - c->source.text) : 0;
+    }
+    out->tokens = c->tokens.count;
+
+    free(code.code);
+    free(c->entries);
+    arenaFree(&c->nodes);
+    free(c->symbolTable);
+    free(c->scope);
+    free(c->varHead);
+    free(c->procHead);
+    freeTokens(&c->tokens);
+    closeSource(&c->source);
+    free(c);
+    return out->failed;
+}
+
+int pl0_emit(const pl0Program *program, FILE *outFile)
+{
+    int i;
+    for (i=0; i<program->length; i++)
+    {
+        fprintf(outFile, "%d %d %d\n", program->code[i].op, program->code[i].lex, program->code[i].mod);
+    }
+    return ferror(outFile) != 0;
+}
+
+int pl0_emitBinary(const pl0Program *program, FILE *outFile)
+{
+    pm0bHeader header;
+    pm0bProcedure procedure;
+    int i, name = 0;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PM0B_MAGIC, 4);
+    header.version = PM0B_VERSION;
+    header.count = program->length;
+    header.procedureCount = program->procedureCount;
+    for (i = 0; i < program->length; i++)
+    {
+        if (program->code[i].op > 9)
+            header.flags |= PM0B_EXTENDED;
+    }
+    for (i = 0; i < program->procedureCount; i++)
+        header.namesSize += strlen(program->procedures[i].name) + 1;
+
+    fwrite(&header, sizeof(header), 1, outFile);
+    fwrite(program->code, sizeof(command), program->length, outFile);   //A command is already three 32 bit ints, the same as in the file
+    for (i = 0; i < program->procedureCount; i++)
+    {
+        procedure.entry = program->procedures[i].entry;
+        procedure.level = program->procedures[i].level;
+        procedure.name = name;
+        name += strlen(program->procedures[i].name) + 1;
+        fwrite(&procedure, sizeof(procedure), 1, outFile);
+    }
+    for (i = 0; i < program->procedureCount; i++)
+        fwrite(program->procedures[i].name, 1, strlen(program->procedures[i].name) + 1, outFile);
+    return ferror(outFile) != 0;
+}
+
+void pl0_free(pl0Program *program)
+{
+    free(program->code);
+    free(program->procedures);                          //The names are in the same block
+    program->procedures = NULL;
+    program->procedureCount = 0;
+    program->code = NULL;
+    program->length = 0;
+}
+
+static astNode *program(compiler *c)
+{
+    astNode *root = block(c);
+    consume(c, periodsym);
+    return root;
+}
+
+static astNode *block(compiler *c)
+{
+    astNode *node = newNode(c, AST_BLOCK);
+
+    constDec(c);
+    varDec(c);
+
+    node->value = c->frameSize;                         //Room for all of our variables
+
+    node->kid[0] = procDec(c);
+    node->kid[1] = statement(c);
+    return node;
+}
+
+static void constDec(compiler *c)
+{
+    if (c->tok.idNum == constsym)
+    {
+        consume(c, constsym);
+        ident(c, 1);
+        /* consume(eqlsym); // Ident will handle this
+        number(); */
+        while (c->tok.idNum == commasym)
+        {
+            consume(c, commasym);
+            ident(c, 1);
+        }
+        consume(c, semicolonsym);
+    }
+}
+
+static void varDec(compiler *c)
+{
+    if (c->tok.idNum == varsym)
+    {
+        consume(c, varsym);
+        ident(c, 2);
+        while (c->tok.idNum == commasym)
+        {
+            consume(c, commasym);
+            ident(c, 2);
+        }
+        consume(c, semicolonsym);
+    }
+}
+
+static astNode *procDec(compiler *c)
+{
+    astNode *first = NULL, **link = &first, *node;
+    int temp;
+    c->lexLev++;                        //Everything in here is one lex level higher than outside
+    while (c->tok.idNum == procsym)
+    {
+        consume(c, procsym);
+        node = newNode(c, AST_PROCEDURE);
+        node->value = ident(c, 3);
+        temp = c->pos;                  //Store the position of the symbol table
+        consume(c, semicolonsym);
+        node->kid[0] = block(c);
+        consume(c, semicolonsym);
+        leaveScope(c, temp);            //Return the symbol table to where we stored it to "delete" the variables for the procedure
+        *link = node;                   //Procedures stay in the order they were declared
+        link = &node->next;
+    }
+    c->lexLev--;                        //Once we're done in here we need to drop back down to the previous lex level
+    return first;
+}
+
+static astNode *statement(compiler *c)
+{
+    int id;
+    astNode *node, **link;
+    switch (c->tok.idNum)
+    {
+        case identsym : id = c->tok.name;       //<ident> := <expression> ** Store the name of the ident token for later
+                        consume(c, identsym);
+                        consume(c, becomessym);
+                        node = newNode(c, AST_ASSIGN);
+                        node->kid[0] = expression(c);
+                        node->value = storeIdent(c, id);    //The value at the top of the stack goes into the identifier we started with.
+                        return node;
+        case callsym  : consume(c, callsym);
+                        node = newNode(c, AST_CALL);
+                        node->value = callIdent(c);
+                        return node;
+        case beginsym : consume(c, beginsym);   //begin <statement> {; <statement>} end
+                        node = newNode(c, AST_BEGIN);
+                        node->kid[0] = statement(c);
+                        link = &node->kid[0]->next;
+                        while (c->tok.idNum == semicolonsym)
+                        {
+                            consume(c, semicolonsym);
+                            *link = statement(c);
+                            link = &(*link)->next;
+                        }
+                        consume(c, endsym);
+                        return node;
+        case ifsym    : consume(c, ifsym);      //if <condition> then <statement>
+                        node = newNode(c, AST_IF);
+                        node->kid[0] = condition(c);
+                        consume(c, thensym);
+                        node->kid[1] = statement(c);
+                        if (c->tok.idNum == elsesym)
+                        {
+                            consume(c, elsesym);
+                            node->kid[2] = statement(c);    //The else statement
+                        }
+                        return node;
+        case whilesym : consume(c, whilesym);   //while <condition> do <statement>
+                        node = newNode(c, AST_WHILE);
+                        node->kid[0] = condition(c);
+                        consume(c, dosym);
+                        node->kid[1] = statement(c);
+                        return node;
+        case readsym  : consume(c, readsym);    //read <ident>
+                        node = newNode(c, AST_READ);
+                        node->value = storeIdent(c, c->tok.name);  //Store the value read in to the ident token we were given.
+                        consume(c, identsym);
+                        return node;
+        case writesym : consume(c, writesym);   //write <ident>
+                        node = newNode(c, AST_WRITE);
+                        node->value = getIdent(c, c->tok.name);    //Retrieve the value of the ident token we were given
+                        consume(c, identsym);
+                        return node;
+        default       : return newNode(c, AST_EMPTY);
+    }
+}
+
+static astNode *condition(compiler *c)
+{
+    astNode *node;
+    if (c->tok.idNum == oddsym)
+    {
+        consume(c, oddsym);
+        node = newNode(c, AST_ODD);
+        node->kid[0] = expression(c);
+    } else
+    {
+        node = newNode(c, AST_COMPARE);
+        node->kid[0] = expression(c);
+        switch(c->tok.idNum)                //The OPR that does the comparison
+        {
+            case eqlsym : consume(c, eqlsym);
+                          node->op = 8;
+                          break;
+            case neqsym : consume(c, neqsym);
+                          node->op = 9;
+                          break;
+            case lessym : consume(c, lessym);
+                          node->op = 10;
+                          break;
+            case leqsym : consume(c, leqsym);
+                          node->op = 11;
+                          break;
+            case gtrsym : consume(c, gtrsym);
+                          node->op = 12;
+                          break;
+            case geqsym : consume(c, geqsym);
+                          node->op = 13;
+                          break;
+            default     : consume(c, neqsym);  // If it's not one of these we need an error of some kind.
+        }
+        node->kid[1] = expression(c);
+    }
+    return node;
+}
+
+static astNode *expression(compiler *c)
+{
+    int isNeg=0;
+    astNode *node, *left;
+    if (c->tok.idNum == plussym)
+    {
+        consume(c, plussym);
+    }
+    else if (c->tok.idNum == minussym)
+    {
+        consume(c, minussym);
+        isNeg = 1;
+    }
+    node = term(c);
+    if (isNeg)
+    {
+        left = node;
+        node = newNode(c, AST_NEGATE);
+        node->kid[0] = left;
+    }
+    while (c->tok.idNum == plussym || c->tok.idNum == minussym)
+    {
+        left = node;
+        node = newNode(c, AST_BINARY);
+        node->kid[0] = left;
+        if (c->tok.idNum == plussym)
+        {
+            consume(c, plussym);
+            node->op = 2;
+        }
+        else
+        {
+            consume(c, minussym);
+            node->op = 3;
+        }
+        node->kid[1] = term(c);
+    }
+    return node;
+}
+
+static astNode *term(compiler *c)
+{
+    astNode *node = factor(c), *left;
+    while (c->tok.idNum == multsym || c->tok.idNum == slashsym)
+    {
+        left = node;
+        node = newNode(c, AST_BINARY);
+        node->kid[0] = left;
+        if (c->tok.idNum == multsym)
+        {
+            consume(c, multsym);
+            node->op = 4;
+        }
+        else
+        {
+            consume(c, slashsym);
+            node->op = 5;
+        }
+        node->kid[1] = factor(c);
+    }
+    return node;
+}
+
+static astNode *factor(compiler *c)
+{
+    astNode *node;
+    if (c->tok.idNum == identsym)
+    {
+        node = newNode(c, AST_IDENT);
+        node->value = getIdent(c, c->tok.name);
+        consume(c, identsym);
+    }else if (c->tok.idNum == numbersym)
+    {
+        node = newNode(c, AST_NUMBER);
+        node->value = c->tok.value;
+        consume(c, numbersym);
+    } else
+    {
+        consume(c, lparentsym);
+        node = expression(c);
+        consume(c, rparentsym);
+    }
+    return node;
+}
+
+static void consume(compiler *c, int last)
+{
+    int next = c->tokenNum;
+
+    if (c->tok.idNum == last)
+    {
+        if (next >= c->tokens.count)
+        {
+            if (c->tokens.failed)                       //This is where the lexer gave up
+            {
+                report(c, "%s", c->source.error);
+                report(c, "Lexer failed to parse token #%d\n", c->tokenNum+1);
+                bail(c);
+            }
+            next = c->tokens.count - 1;                 //Past the end of the file we keep seeing the final nulsym
+        }
+        c->tok.idNum = c->tokens.type[next];
+        c->tok.value = c->tokens.value[next];
+        c->tok.name = (c->tok.idNum == identsym) ? c->tok.value : -1;   //The lexer already turned the name into an id
+        c->tok.text = c->source.text + c->tokens.offset[next];
+        c->tok.length = c->tokens.length[next];
+    } else
+    {
+        report(c, "Wrong token at token #%d\n", c->tokenNum);
+        switch (last)
+        {
+        case nulsym:
+            report(c, "Expected nulsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case identsym:
+            report(c, "Expected identsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case numbersym:
+            report(c, "Expected numbersym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case plussym:
+            report(c, "Expected plussym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case minussym:
+            report(c, "Expected minussym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case multsym:
+            report(c, "Expected multsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case slashsym:
+            report(c, "Expected slashsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case oddsym:
+            report(c, "Expected oddsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case eqlsym:
+            report(c, "Expected eqlsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case neqsym:
+            report(c, "Expected neqsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case lessym:
+            report(c, "Expected lessym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case leqsym:
+            report(c, "Expected leqsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case gtrsym:
+            report(c, "Expected gtrsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case geqsym:
+            report(c, "Expected geqsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case lparentsym:
+            report(c, "Expected lparentsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case rparentsym:
+            report(c, "Expected rparentsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case commasym:
+            report(c, "Expected commasym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case semicolonsym:
+            report(c, "Expected semicolonsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case periodsym:
+            report(c, "Expected periodsym, but found %s instead.\n", symbolName[c->tok.idNum]);
+            bail(c);
+        case becomessym:
+            report(c, "Expected becomessym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case beginsym:
+            report(c, "Expected beginsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case endsym:
+            report(c, "Expected endsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case ifsym:
+            report(c, "Expected ifsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case thensym:
+            report(c, "Expected thensym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case whilesym:
+            report(c, "Expected whilesym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case dosym:
+            report(c, "Expected dosym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case callsym:
+            report(c, "Expected callsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case constsym:
+            report(c, "Expected constsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case varsym:
+            report(c, "Expected varsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case procsym:
+            report(c, "Expected procsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case writesym:
+            report(c, "Expected writesym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case readsym:
+            report(c, "Expected readsym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        case elsesym:
+            report(c, "Expected elsesym, but found %s: %.*s instead.\n", symbolName[c->tok.idNum], c->tok.length, c->tok.text);
+            bail(c);
+        default:
+            report(c, "WHAT? This shouldn't happen! Token expected was %s\n", symbolName[last]);
+            bail(c);
+        }
+    }
+    c->tokenNum++;
+}
+
+static astNode *newNode(compiler *c, int kind)
+{
+    astNode *node = arenaAlloc(&c->nodes, sizeof(astNode));
+    if (node == NULL)
+    {
+        report(c, "Out of memory\n");
+        bail(c);
+    }
+    node->kind = kind;
+    return node;
+}
+
+static int ident(compiler *c, int kind)
+{
+    symbol *sym;
+
+    if (c->tok.name >= 0)                               //If it isn't a name at all consume will complain below
+    {
+        if (kind == 3 && c->procHead[c->tok.name] != -1)    //Can't have 2 accessible procedures with the same name
+        {
+            report(c, "Error, procedure with the name %.*s already exists.\n", c->tok.length, c->tok.text);
+            report(c, "At lex level %d\n", c->lexLev);
+            bail(c);
+        } else if (kind != 3 && c->varHead[c->tok.name] != -1 && c->symbolTable[c->varHead[c->tok.name]].level == c->lexLev)    //Only the innermost one can be at our level
+        {
+            report(c, "Error, duplicate identifier\n");    //Can't have two identifiers in the list at the same level with the same name
+            bail(c);
+        }
+    }
+
+    if (c->symbolCount == c->symbolCap)                 //Out of room, double the table and the scope with it
+    {
+        int cap = c->symbolCap ? c->symbolCap * 2 : 64;
+        symbol *grown = realloc(c->symbolTable, cap * sizeof(symbol));
+        int *scope = grown ? realloc(c->scope, cap * sizeof(int)) : NULL;
+        if (grown != NULL)
+            c->symbolTable = grown;
+        if (scope == NULL)
+        {
+            report(c, "Out of memory, too many symbols\n");
+            bail(c);
+        }
+        c->scope = scope;
+        c->symbolCap = cap;
+    }
+    sym = &c->symbolTable[c->symbolCount];
+    if (kind == 1)                                      //If our ident is a constant
+    {
+        sym->kind = 1;                                  //Mark the ident as a constant
+        sym->name = c->tok.name;                        //Save the name id of the constant into the table
+        consume(c, identsym);                           //Next symbol
+        consume(c, eqlsym);                             //Next symbol
+        sym->val = c->tok.value;                        //Save the value of the constant into the table
+        consume(c, numbersym);                          //Next symbol
+        sym->level = c->lexLev;                         //Set the lex level of our constant
+    }else if (kind == 2)                                //If our ident is a variable
+    {
+        sym->kind = 2;                                  //Mark it as a variable
+        sym->name = c->tok.name;                        //Save the name id into the table
+        sym->level = c->lexLev;                         //Set the proper lex level
+        sym->addr = c->frameSize;                       //Save the memory position of the variable into the table
+        c->frameSize++;                                 //Increase the frame size
+        consume(c, identsym);                           //Next symbol
+    }else if (kind == 3)
+    {
+        sym->kind = 3;                                  //Mark the identifier as a procedure
+        sym->name = c->tok.name;                        //Save the name id into the table
+        sym->level = c->lexLev;                         //Set the proper lex level
+        sym->addr = 0;                                  //The code generator knows where the procedure starts
+        c->frameSize = 4;                               //reset the framesize since we're going to have a new stack frame
+        consume(c, identsym);                           //Next symbol
+    }
+    if (kind == 3)                                      //The name means this symbol now
+    {
+        sym->shadow = c->procHead[sym->name];
+        c->procHead[sym->name] = c->symbolCount;
+    } else
+    {
+        sym->shadow = c->varHead[sym->name];
+        c->varHead[sym->name] = c->symbolCount;
+    }
+    c->scope[c->pos] = c->symbolCount;                  //It's in scope until its procedure ends
+    c->pos++;                                           //Next position in the scope
+    return c->symbolCount++;
+}
+
+static void leaveScope(compiler *c, int mark)
+{
+    symbol *sym;
+    while (c->pos > mark)
+    {
+        c->pos--;
+        sym = &c->symbolTable[c->scope[c->pos]];
+        if (sym->kind == 3)
+            c->procHead[sym->name] = sym->shadow;
+        else
+            c->varHead[sym->name] = sym->shadow;
+    }
+}
+
+static int getIdent(compiler *c, int name)
+{
+    int loc = (name >= 0) ? c->varHead[name] : -1;      //Whatever the name means at this point in the program
+    if (loc == -1)
+    {
+        report(c, "Identifier not declared in symbol table\n");
+        bail(c);
+    }
+    return loc;                                         //A constant or a variable, the code generator will load either
+}
+
+static int storeIdent(compiler *c, int name)
+{
+    int loc = (name >= 0) ? c->varHead[name] : -1;
+    if (loc == -1)
+    {
+        report(c, "Identifier not declared in symbol table\n");
+        bail(c);
+    }
+    if (c->symbolTable[loc].kind == 1)                  //If it's a constant
+    {
+        report(c, "Cannot change the value of a constant\n");  //Can't change a constant
+        bail(c);
+    }
+    return loc;                                         //Otherwise it's a variable and we can store it
+}
+
+static int callIdent(compiler *c)
+{
+    int loc = (c->tok.name >= 0) ? c->procHead[c->tok.name] : -1;
+    if (loc == -1)
+    {
+        report(c, "Undeclared procedure\n");
+        bail(c);
+    }
+    consume(c, identsym);
+    return loc;
+}
+
+static void report(compiler *c, const char *format, ...)
+{
+    size_t used = strlen(c->out->message);
+    va_list args;
+    va_start(args, format);
+    vsnprintf(c->out->message + used, sizeof(c->out->message) - used, format, args);
+    va_end(args);
+}
+
+static _Noreturn void bail(compiler *c)
+{
+    longjmp(c->bailOut, 1);
+}
+
+static int listProcedures(compiler *c, codeBuffer *code)
+{
+    pl0Program *out = c->out;
+    nameTable *names = &c->tokens.names;
+    size_t namesSize = 0;
+    char *name;
+    int i, count = 0;
+
+    for (i = 0; i < c->symbolCount; i++)
+    {
+        if (c->symbolTable[i].kind == 3)
+        {
+            count++;
+            namesSize += names->length[c->symbolTable[i].name] + 1;
+        }
+    }
+    if (count == 0)
+        return 0;
+    out->procedures = malloc(count * sizeof(pl0Procedure) + namesSize);    //The names go after the table, in the same block
+    c->entries = malloc(count * sizeof(int));
+    if (out->procedures == NULL || c->entries == NULL)
+        return 1;
+
+    name = (char *)(out->procedures + count);
+    for (i = 0; i < c->symbolCount; i++)
+    {
+        symbol *sym = &c->symbolTable[i];
+        if (sym->kind != 3)
+            continue;
+        memcpy(name, names->text[sym->name], names->length[sym->name]);
+        name[names->length[sym->name]] = '\0';
+        out->procedures[out->procedureCount].name = name;
+        out->procedures[out->procedureCount].level = sym->level;
+        if (sym->addr < 0)                              //Nothing calls it, it has no code
+            c->entries[out->procedureCount] = -1;
+        else                                            //addr is the jump past the procedure's own procedures, to its body
+            c->entries[out->procedureCount] = code->code[sym->addr].mod;
+        name += names->length[sym->name] + 1;
+        out->procedureCount++;
+    }
+    return 0;
+}
+
+static double nowMs()
+{
+#ifndef _WIN32
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);               //Wall time, clock() would add up every thread in the process
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1000000.0;
+#else
+    return clock() * 1000.0 / CLOCKS_PER_SEC;
+#endif
+}
@@ -0,0 +1,87 @@
+#ifndef COMPILER_H_INCLUDED
+#define COMPILER_H_INCLUDED
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define PL0_VERSION "1.4"   // Part of every cache key, so change it whenever the code generated for a program changes
+#define PL0_INLINE_LIMIT 16 // Biggest procedure body inlined by default, in syntax tree nodes
+
+/**
+ *  The PL/0 compiler as a library.
+ *
+ *  pl0_compile keeps everything it needs in a context of its own and never
+ *  exits or prints, so any number of threads can compile different programs
+ *  at the same time. Problems with the program come back in the pl0Program
+ *  as the same text the command line compiler prints.
+ */
+
+/**
+ *  One PM/0 instruction. Ops 1 to 9 are the classic ISA: LIT OPR LOD STO CAL
+ *  INC JMP JPC SIO. Unless pl0Options.classic is set the compiler also uses
+ *  the fused instructions of the extended ISA, which vm.c runs as well:
+ *
+ *  10-15 JEQ JNE JLT JLE JGT JGE  0 M   pop b, pop a, jump to M if a = <> < <= > >= b
+ *  16-19 LADD LSUB LMUL LDIV      L M   LOD L M then OPR ADD SUB MUL DIV
+ *  20-23 IADD ISUB IMUL IDIV      0 M   LIT 0 M then OPR ADD SUB MUL DIV
+ *  24    JNZ                      0 M   pop, jump to M if it isn't 0. JPC the other way round
+ */
+typedef struct command
+{
+    int op;
+    int lex;
+    int mod;
+} command;
+
+/**
+ *  How to compile. Pass NULL to pl0_compile for the defaults.
+ */
+typedef struct pl0Options
+{
+    int lexThreads;         // Threads to lex with, 0 for one per core. Use 1 if the caller is already running one compile per core
+    int noFold;             // 1 to generate every expression exactly as written, without constant folding
+    int noPeephole;         // 1 to keep the program exactly as the code generator made it
+    int classic;            // 1 to use only the classic PM/0 instructions, for VMs that don't know the fused ones
+    int noPrune;            // 1 to generate code for every procedure, even ones nothing calls
+    int noInline;           // 1 to keep every call a CAL
+    int inlineLimit;        // Biggest leaf procedure body to inline, in syntax tree nodes. 0 for PL0_INLINE_LIMIT
+} pl0Options;
+
+/**
+ *  A procedure of the program and where its code ended up.
+ */
+typedef struct pl0Procedure
+{
+    const char *name;       // Null terminated
+    int level;              // Lex level its body runs at
+    int entry;              // Address of its first instruction, -1 if nothing calls it and it was left out
+} pl0Procedure;
+
+/**
+ *  What pl0_compile made of a program. Release it with pl0_free.
+ */
+typedef struct pl0Program
+{
+    command *code;          // The PM/0 program, NULL if compiling failed
+    int length;             // Number of instructions in code
+    int generatedLength;    // Number of instructions before the peephole pass took any out
+    int inlinedCalls;       // Number of calls replaced by the body of the procedure they called
+    int deadProcedures;     // Number of procedures left out because no call can reach them
+    pl0Procedure *procedures;   // Every procedure the program declares, in the order it declares them
+    int procedureCount;     // Number of procedures
+    int tokens;             // Number of tokens the lexer found
+    double lexMs;           // Time spent lexing, in milliseconds
+    double parseMs;         // Time spent parsing, in milliseconds
+    double genMs;           // Time spent optimizing and generating code, in milliseconds
+    int failed;             // 1 if the program has an error, the rest of the fields say what it was
+    int errorToken;         // Number of the token the parser was on
+    size_t errorOffset;     // Where that token starts in the source
+    char message[256];      // What went wrong, one or more lines each ending in \n
+} pl0Program;
+
+int pl0_compile(const char *src, size_t len, const pl0Options *options, pl0Program *out);  // Compiles len bytes of src into out, returns 0 on success and 1 on error
+int pl0_emit(const pl0Program *program, FILE *outFile);    // Writes the program out as a .pm0 file, returns 0 on success
+int pl0_emitBinary(const pl0Program *program, FILE *outFile);  // Writes the program out as PM0B, see pm0b.h. outFile must be opened "wb". Returns 0 on success
+void pl0_free(pl0Program *program);                         // Releases what pl0_compile allocated
+
+#endif // COMPILER_H_INCLUDED
@@ -0,0 +1,204 @@
+#include <limits.h>
+#include "ast.h"
+
+/**
+ *  Constant folding and algebraic simplification, done on the syntax tree
+ *  between parsing and code generation.
+ *
+ *  Constants are replaced by their values, then anything whose operands are
+ *  all numbers becomes a number: arithmetic, negation, odd and comparisons.
+ *  The arithmetic is done the way the VM does it on its int stack, wrapping
+ *  around on overflow and truncating division towards zero.
+ *
+ *  Identities drop the work that doesn't change the value: x+0, 0+x, x-0,
+ *  x*1, 1*x, x/1 and - -x become x, 0-x becomes -x, and x*0 and 0*x become 0.
+ *
+ *  Nothing is folded that would hide a run time error. A division by zero
+ *  is left for the VM to hit, and x*0 stays as it is when x has a division
+ *  in it that could fail.
+ *
+ *  An if or while whose condition is a constant loses the test: the branch
+ *  that can't run is dropped, and so is a loop that never runs. A loop that
+ *  always runs keeps its number as the condition, the code generator knows
+ *  not to test it.
+ */
+static astNode *foldStatement(astNode *statement, symbol *symbols);
+static astNode *foldExpression(astNode *expression, symbol *symbols);
+static int canFail(astNode *expression);
+static int isNumber(astNode *expression, int value);
+
+void foldConstants(astNode *program, symbol *symbols)
+{
+    astNode *procedure;
+
+    for (procedure = program->kid[0]; procedure != NULL; procedure = procedure->next)
+        foldConstants(procedure->kid[0], symbols);
+    program->kid[1] = foldStatement(program->kid[1], symbols);
+}
+
+static astNode *foldStatement(astNode *statement, symbol *symbols)
+{
+    astNode **link, *next;
+
+    switch (statement->kind)
+    {
+        case AST_ASSIGN : statement->kid[0] = foldExpression(statement->kid[0], symbols);
+                          break;
+        case AST_BEGIN  : for (link = &statement->kid[0]; *link != NULL; link = &(*link)->next)
+                          {
+                              next = (*link)->next;         //The statement may be swapped for another, which has to take its place in the list
+                              *link = foldStatement(*link, symbols);
+                              (*link)->next = next;
+                          }
+                          break;
+        case AST_IF     : statement->kid[0] = foldExpression(statement->kid[0], symbols);
+                          if (statement->kid[0]->kind == AST_NUMBER)    //We already know which way it goes
+                          {
+                              if (statement->kid[0]->value != 0)
+                                  return foldStatement(statement->kid[1], symbols);
+                              if (statement->kid[2] != NULL)
+                                  return foldStatement(statement->kid[2], symbols);
+                              statement->kind = AST_EMPTY;
+                              break;
+                          }
+                          statement->kid[1] = foldStatement(statement->kid[1], symbols);
+                          if (statement->kid[2] != NULL)
+                              statement->kid[2] = foldStatement(statement->kid[2], symbols);
+                          break;
+        case AST_WHILE  : statement->kid[0] = foldExpression(statement->kid[0], symbols);
+                          if (isNumber(statement->kid[0], 0))           //Never runs
+                          {
+                              statement->kind = AST_EMPTY;
+                              break;
+                          }
+                          statement->kid[1] = foldStatement(statement->kid[1], symbols);
+                          break;
+        default         : break;
+    }
+    return statement;
+}
+
+static astNode *foldExpression(astNode *expression, symbol *symbols)
+{
+    astNode *left, *right;
+    unsigned a, b;
+
+    switch (expression->kind)
+    {
+        case AST_IDENT   : if (symbols[expression->value].kind == 1)   //A constant is just its number
+                           {
+                               expression->kind = AST_NUMBER;
+                               expression->value = symbols[expression->value].val;
+                           }
+                           return expression;
+        case AST_NEGATE  : left = expression->kid[0] = foldExpression(expression->kid[0], symbols);
+                           if (left->kind == AST_NUMBER)
+                           {
+                               left->value = (int)(0u - (unsigned)left->value);
+                               return left;
+                           }
+                           if (left->kind == AST_NEGATE)                //- -x
+                               return left->kid[0];
+                           return expression;
+        case AST_ODD     : left = expression->kid[0] = foldExpression(expression->kid[0], symbols);
+                           if (left->kind == AST_NUMBER)
+                           {
+                               left->value = left->value & 1;           //The same test OPR ODD does
+                               return left;
+                           }
+                           return expression;
+        case AST_BINARY  :
+        case AST_COMPARE : break;
+        default          : return expression;
+    }
+
+    left = expression->kid[0] = foldExpression(expression->kid[0], symbols);
+    right = expression->kid[1] = foldExpression(expression->kid[1], symbols);
+
+    if (left->kind == AST_NUMBER && right->kind == AST_NUMBER)
+    {
+        a = (unsigned)left->value;                      //Unsigned so overflow wraps around like it does in the VM
+        b = (unsigned)right->value;
+        switch (expression->op)
+        {
+            case 2  : left->value = (int)(a + b);
+                      return left;
+            case 3  : left->value = (int)(a - b);
+                      return left;
+            case 4  : left->value = (int)(a * b);
+                      return left;
+            case 5  : if (right->value == 0 || (left->value == INT_MIN && right->value == -1))
+                          return expression;            //Leave it to fail at run time, like it always has
+                      left->value = left->value / right->value;
+                      return left;
+            case 8  : left->value = left->value == right->value;
+                      return left;
+            case 9  : left->value = left->value != right->value;
+                      return left;
+            case 10 : left->value = left->value < right->value;
+                      return left;
+            case 11 : left->value = left->value <= right->value;
+                      return left;
+            case 12 : left->value = left->value > right->value;
+                      return left;
+            case 13 : left->value = left->value >= right->value;
+                      return left;
+        }
+        return expression;
+    }
+
+    switch (expression->op)
+    {
+        case 2 : if (isNumber(right, 0))                //x+0
+                     return left;
+                 if (isNumber(left, 0))                 //0+x
+                     return right;
+                 break;
+        case 3 : if (isNumber(right, 0))                //x-0
+                     return left;
+                 if (isNumber(left, 0))                 //0-x is just -x
+                 {
+                     expression->kind = AST_NEGATE;
+                     expression->kid[0] = right;
+                     expression->kid[1] = NULL;
+                     return foldExpression(expression, symbols);
+                 }
+                 break;
+        case 4 : if (isNumber(right, 1))                //x*1
+                     return left;
+                 if (isNumber(left, 1))                 //1*x
+                     return right;
+                 if (isNumber(right, 0) && !canFail(left))  //x*0
+                     return right;
+                 if (isNumber(left, 0) && !canFail(right))  //0*x
+                     return left;
+                 break;
+        case 5 : if (isNumber(right, 1))                //x/1
+                     return left;
+                 break;
+    }
+    return expression;
+}
+
+/**
+ *  1 if working out the expression could stop the VM, which only a
+ *  division can do: by zero, or the smallest int by -1.
+ */
+static int canFail(astNode *expression)
+{
+    switch (expression->kind)
+    {
+        case AST_NEGATE  :
+        case AST_ODD     : return canFail(expression->kid[0]);
+        case AST_BINARY  : if (expression->op == 5 && (expression->kid[1]->kind != AST_NUMBER || expression->kid[1]->value == 0 || expression->kid[1]->value == -1))
+                               return 1;
+                           return canFail(expression->kid[0]) || canFail(expression->kid[1]);
+        case AST_COMPARE : return canFail(expression->kid[0]) || canFail(expression->kid[1]);
+        default          : return 0;
+    }
+}
+
+static int isNumber(astNode *expression, int value)
+{
+    return expression->kind == AST_NUMBER && expression->value == value;
+}
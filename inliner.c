@@ -0,0 +1,278 @@
+#include <stdlib.h>
+#include "ast.h"
+
+/**
+ *  Inlining of small leaf procedures, on the syntax tree before code is
+ *  generated for it.
+ *
+ *  A call costs a CAL, which builds a four slot activation record, then
+ *  the callee's INC and its RET. For a procedure whose body is only a
+ *  handful of nodes that is more work than the body, so a call to a
+ *  procedure that calls nothing itself, and whose body is no bigger than
+ *  the limit, is replaced by a copy of the body.
+ *
+ *  The copy runs in the caller's frame. The callee's variables get new
+ *  symbols at the caller's level, in a region added to the end of the
+ *  caller's frame. No two copies run at once, so every call inlined into
+ *  a block shares that region, which is as big as the biggest callee's
+ *  variables. Everything else the body uses belongs to a block
+ *  around the callee, and the caller's static chain reaches those frames
+ *  just like the callee's would have, so those symbols stay as they are and
+ *  the code generator works out their levels from the caller's.
+ *
+ *  Callees are inlined into before their callers, so a procedure that only
+ *  called leaves becomes a leaf itself once they are inlined. A procedure
+ *  that ends up called from nowhere is left for pruneProcedures to take out.
+ */
+typedef struct inliner
+{
+    symbol **symbols;       // The compiler's symbol table, which grows as callees' variables are copied
+    int *symbolCount;
+    int *symbolCap;
+    arena *nodes;           // Where the copies of bodies go
+    int limit;              // Biggest body to inline, in nodes
+    astNode **blocks;       // Each procedure's block, by symbol index
+    char *state;            // By symbol index: 0 not looked at yet, 1 being inlined into, 2 done
+    char *leaf;             // By symbol index: 1 if the procedure is done and calls nothing
+    int inlined;            // Calls replaced so far
+    int frame;              // Size of the block being inlined into before any of it, where its shared region starts
+    int region;             // Slots that region needs so far
+} inliner;
+
+/**
+ *  Where one copy of a body is going: the callee's variables, by their
+ *  offset in its frame, map to new symbols at the caller's level.
+ */
+typedef struct inlineSite
+{
+    int calleeLevel;
+    int callerLevel;
+    int base;               // First slot of the caller's frame the callee's variables get
+    int *map;               // Symbol for the callee's variable at offset 4+i, -1 until it's needed
+} inlineSite;
+
+static void findBlocks(astNode *block, astNode **blocks);
+static void inlineBlock(inliner *in, astNode *block, int level);
+static void inlineStatement(inliner *in, astNode *statement, int level);
+static void inlineCall(inliner *in, astNode *statement, int level);
+static astNode *copyTree(inliner *in, inlineSite *site, astNode *node);
+static int copyVariable(inliner *in, inlineSite *site, int variable);
+static int hasCalls(astNode *statement);
+static int countNodes(astNode *node);
+
+int inlineCalls(astNode *program, symbol **symbols, int *symbolCount, int *symbolCap, arena *nodes, int limit)
+{
+    inliner in;
+
+    in.symbols = symbols;
+    in.symbolCount = symbolCount;
+    in.symbolCap = symbolCap;
+    in.nodes = nodes;
+    in.limit = limit;
+    in.inlined = 0;
+    in.frame = 0;
+    in.region = 0;
+    in.blocks = calloc(*symbolCount + 1, sizeof(astNode *));
+    in.state = calloc(*symbolCount + 1, 1);
+    in.leaf = calloc(*symbolCount + 1, 1);
+    if (in.blocks != NULL && in.state != NULL && in.leaf != NULL)    //Otherwise leave the program as it is
+    {
+        findBlocks(program, in.blocks);
+        inlineBlock(&in, program, 0);
+    }
+    free(in.blocks);
+    free(in.state);
+    free(in.leaf);
+    return in.inlined;
+}
+
+static void findBlocks(astNode *block, astNode **blocks)
+{
+    astNode *procedure;
+
+    for (procedure = block->kid[0]; procedure != NULL; procedure = procedure->next)
+    {
+        blocks[procedure->value] = procedure->kid[0];
+        findBlocks(procedure->kid[0], blocks);
+    }
+}
+
+/**
+ *  Inlines whatever it can into block's statement, then grows its frame by
+ *  the region the inlined calls share.
+ */
+static void inlineBlock(inliner *in, astNode *block, int level)
+{
+    int frame = in->frame, region = in->region;     //A callee's block is done in the middle of its caller's
+
+    in->frame = block->value;
+    in->region = 0;
+    inlineStatement(in, block->kid[1], level);
+    block->value += in->region;
+    in->frame = frame;
+    in->region = region;
+}
+
+/**
+ *  Inlines whatever it can into statement, which runs at lex level level.
+ */
+static void inlineStatement(inliner *in, astNode *statement, int level)
+{
+    astNode *inner;
+
+    switch (statement->kind)
+    {
+        case AST_CALL   : inlineCall(in, statement, level);
+                          break;
+        case AST_BEGIN  : for (inner = statement->kid[0]; inner != NULL; inner = inner->next)
+                              inlineStatement(in, inner, level);
+                          break;
+        case AST_IF     : inlineStatement(in, statement->kid[1], level);
+                          if (statement->kid[2] != NULL)
+                              inlineStatement(in, statement->kid[2], level);
+                          break;
+        case AST_WHILE  : inlineStatement(in, statement->kid[1], level);
+                          break;
+        default         : break;
+    }
+}
+
+static void inlineCall(inliner *in, astNode *statement, int level)
+{
+    int callee = statement->value, i, *map;
+    astNode *body, *copy, *next;
+    inlineSite site;
+
+    if (in->state[callee] == 0)                     //Do the callee's own calls first, it may turn into a leaf
+    {
+        in->state[callee] = 1;                      //A call back to it from in there is recursion, and stays a call
+        inlineBlock(in, in->blocks[callee], (*in->symbols)[callee].level);
+        in->state[callee] = 2;
+        in->leaf[callee] = !hasCalls(in->blocks[callee]->kid[1]);
+    }
+    body = in->blocks[callee]->kid[1];
+    if (in->state[callee] != 2 || !in->leaf[callee] || countNodes(body) > in->limit)
+        return;
+
+    map = malloc((in->blocks[callee]->value - 4 + 1) * sizeof(int));
+    if (map == NULL)
+        return;
+    for (i = 0; i < in->blocks[callee]->value - 4; i++)
+        map[i] = -1;
+    site.calleeLevel = (*in->symbols)[callee].level;
+    site.callerLevel = level;
+    site.base = in->frame;
+    site.map = map;
+
+    copy = copyTree(in, &site, body);
+    free(map);
+    if (copy == NULL)                               //Out of memory, it stays a call
+        return;
+    if (in->blocks[callee]->value - 4 > in->region)  //Room for the callee's variables in the caller's shared region
+        in->region = in->blocks[callee]->value - 4;
+    next = statement->next;
+    *statement = *copy;                             //The call becomes the body, keeping its place in a begin
+    statement->next = next;
+    in->inlined++;
+}
+
+/**
+ *  Copies node and everything under and after it, pointing the callee's
+ *  variables at their new symbols. Returns NULL if it ran out of memory.
+ */
+static astNode *copyTree(inliner *in, inlineSite *site, astNode *node)
+{
+    astNode *copy;
+    int i;
+
+    if (node == NULL)
+        return NULL;
+    copy = arenaAlloc(in->nodes, sizeof(astNode));
+    if (copy == NULL)
+        return NULL;
+    *copy = *node;
+    if (node->kind == AST_ASSIGN || node->kind == AST_READ || node->kind == AST_WRITE || node->kind == AST_IDENT)
+    {
+        symbol *sym = &(*in->symbols)[node->value];
+        if (sym->kind == 2 && sym->level == site->calleeLevel)     //One of the callee's variables, nothing else in its body has its level
+        {
+            copy->value = copyVariable(in, site, node->value);
+            if (copy->value < 0)
+                return NULL;
+        }
+    }
+    for (i = 0; i < 3; i++)
+    {
+        if (node->kid[i] != NULL && (copy->kid[i] = copyTree(in, site, node->kid[i])) == NULL)
+            return NULL;
+    }
+    if (node->next != NULL && (copy->next = copyTree(in, site, node->next)) == NULL)
+        return NULL;
+    return copy;
+}
+
+/**
+ *  Returns the symbol the callee's variable has at this site, making it the
+ *  first time, or -1 if the symbol table couldn't grow.
+ */
+static int copyVariable(inliner *in, inlineSite *site, int variable)
+{
+    int offset = (*in->symbols)[variable].addr - 4;
+    symbol *sym;
+
+    if (site->map[offset] >= 0)
+        return site->map[offset];
+    if (*in->symbolCount == *in->symbolCap)
+    {
+        int cap = *in->symbolCap ? *in->symbolCap * 2 : 64;
+        symbol *grown = realloc(*in->symbols, cap * sizeof(symbol));
+        if (grown == NULL)
+            return -1;
+        *in->symbols = grown;
+        *in->symbolCap = cap;
+    }
+    sym = &(*in->symbols)[*in->symbolCount];
+    *sym = (*in->symbols)[variable];
+    sym->level = site->callerLevel;
+    sym->addr = site->base + offset;
+    site->map[offset] = (*in->symbolCount)++;
+    return site->map[offset];
+}
+
+static int hasCalls(astNode *statement)
+{
+    astNode *inner;
+
+    switch (statement->kind)
+    {
+        case AST_CALL   : return 1;
+        case AST_BEGIN  : for (inner = statement->kid[0]; inner != NULL; inner = inner->next)
+                          {
+                              if (hasCalls(inner))
+                                  return 1;
+                          }
+                          return 0;
+        case AST_IF     : return hasCalls(statement->kid[1]) || (statement->kid[2] != NULL && hasCalls(statement->kid[2]));
+        case AST_WHILE  : return hasCalls(statement->kid[1]);
+        default         : return 0;
+    }
+}
+
+/**
+ *  Size of a body, roughly the instructions it generates.
+ */
+static int countNodes(astNode *node)
+{
+    int count = 0, i;
+
+    for (; node != NULL; node = node->next)
+    {
+        count++;
+        for (i = 0; i < 3; i++)
+        {
+            if (node->kid[i] != NULL)
+                count += countNodes(node->kid[i]);
+        }
+    }
+    return count;
+}
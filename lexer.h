@@ -1,7 +1,105 @@
 #ifndef LEXER_H_INCLUDED
 #define LEXER_H_INCLUDED
 
+#include <stdio.h>
+#include <stddef.h>
+
+enum Token_Name
+{
+    nulsym = 1,
+    identsym = 2,
+    numbersym = 3,
+    plussym = 4,
+    minussym = 5,
+    multsym = 6,
+    slashsym = 7,
+    oddsym = 8,
+    eqlsym = 9,
+    neqsym = 10,
+    lessym = 11,
+    leqsym = 12,
+    gtrsym = 13,
+    geqsym = 14,
+    lparentsym = 15,
+    rparentsym = 16,
+    commasym = 17,
+    semicolonsym = 18,
+    periodsym = 19,
+    becomessym = 20,
+    beginsym = 21,
+    endsym = 22,
+    ifsym = 23,
+    thensym = 24,
+    whilesym = 25,
+    dosym = 26,
+    callsym = 27,
+    constsym = 28,
+    varsym = 29,
+    procsym = 30,
+    writesym = 31,
+    readsym = 32,
+    elsesym = 33
+};
+
+/**
+ *  A whole program held in memory, either mapped straight from the file or
+ *  read into a buffer in one go. getNextSpan walks it with "at" and hands
+ *  tokens back as spans of text instead of copies.
+ */
+typedef struct lexSource
+{
+    const char *text;   // The program text, not null terminated
+    size_t length;      // Number of bytes in text
+    size_t at;          // Offset of the next character the lexer will look at
+    int mapped;         // 1 if text is an mmap'd view of the file, 2 if it belongs to the caller, 0 if we own a buffer
+    char error[96];     // What went wrong when getNextSpan returns 1
+} lexSource;
+
+/**
+ *  Every distinct identifier in a program, each given a small number (its id)
+ *  the first time the lexer sees it. After lexing, two identifiers are the
+ *  same name exactly when their ids are equal. The spelling is not copied,
+ *  text points into the source the name was first seen in.
+ */
+typedef struct nameTable
+{
+    int count;          // Number of distinct names, ids run 0 to count-1
+    int slotCount;      // Size of the hash, always a power of two
+    int *slots;         // id+1 of the name hashed there, 0 if the slot is empty
+    unsigned *hash;     // Each name's hash, by id
+    const char **text;  // Each name's spelling, by id. Not null terminated
+    int *length;        // Each name's length, by id
+} nameTable;
+
+/**
+ *  The whole program already cut into tokens, one entry per token spread over
+ *  parallel arrays so the parser only touches the fields it needs.
+ *  The last entry is the nulsym at the end of the file, unless failed is set,
+ *  in which case lexing stopped at entry count and the reason is in the
+ *  lexSource's error.
+ */
+typedef struct tokenStream
+{
+    int count;          // Number of tokens in the arrays
+    int capacity;       // Number of tokens the arrays have room for
+    int failed;         // 1 if the lexer hit an error after token count-1, 2 if it ran out of memory there
+    int *type;          // Token type from "const int symbols"
+    size_t *offset;     // Where the token's text starts in the source
+    int *length;        // How many characters of text the token has
+    int *value;         // The value of a numbersym, the name id of an identsym, 0 for everything else
+    nameTable names;    // What the identsym ids stand for
+} tokenStream;
+
 int getNextToken(FILE *inFile, int *ftoken, char *value);    // Gets the next token in the file
 int nextState(int state, char next);    // Retrieves next state for analyzeTokens
 
+int openSource(lexSource *src, const char *fileName);      // Loads the whole file for the span lexer
+void borrowSource(lexSource *src, const char *text, size_t length);    // Lexes text already in memory, without copying it
+void closeSource(lexSource *src);                           // Releases what openSource loaded
+int getNextSpan(lexSource *src, int *ftoken, size_t *offset, int *length);  // Gets the next token as (offset, length, type)
+int tokenize(lexSource *src, tokenStream *stream);          // Lexes the whole source into stream
+int tokenizeParallel(lexSource *src, tokenStream *stream, int threads);    // Same as tokenize, split over threads
+void freeTokens(tokenStream *stream);                       // Releases the stream's arrays
+int internName(nameTable *names, const char *text, int length);    // Returns the id for a name, adding it if it's new
+
 #endif // LEXER_H_INCLUDED
@@ -0,0 +1,130 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ast.h"
+
+/**
+ *  A peephole pass over the generated program, run once code generation is
+ *  done and before the program is written out.
+ *
+ *  Jumps are threaded: a JMP, JPC, J<rel>, JNZ or CAL that lands on a JMP
+ *  goes straight to where that JMP goes. That leaves most of the JMPs at the
+ *  start of each procedure with nothing jumping to them.
+ *
+ *  Then whatever can't run is taken out. That is anything the program can't
+ *  reach from the first instruction, a JMP to the instruction that would run
+ *  next anyway, like the one a block with no procedures starts with, and a
+ *  LOD x straight followed by a STO x, which puts back what it just read.
+ *
+ *  Every jump and call is pointed at the new place of its target as the
+ *  program closes up, and so is each of the entries the caller wants kept
+ *  track of, or it becomes -1 if its instruction was taken out. Taking
+ *  things out can make more jumps go to the next instruction, so it goes
+ *  again until nothing changes.
+ */
+static int isJump(command *instruction);     //1 for the instructions whose mod is an address: CAL, JMP, JPC, J<rel> and JNZ
+
+void peephole(codeBuffer *out, int *entries, int entryCount)
+{
+    command *code = out->code;
+    int n = out->count, i, j, t, hops, removed;
+    int *work = malloc((2 * n + 2) * sizeof(int));  //Every instruction pushes at most two more
+    int *newIndex = malloc((n + 1) * sizeof(int));
+    char *keep = malloc(n + 1), *jumpedTo = malloc(n + 1);
+
+    if (work == NULL || newIndex == NULL || keep == NULL || jumpedTo == NULL)
+    {
+        free(work);                                 //Not worth failing the compile over, the program is fine as it is
+        free(newIndex);
+        free(keep);
+        free(jumpedTo);
+        return;
+    }
+
+    do
+    {
+        for (i = 0; i < n; i++)                     //Thread jumps that land on a JMP
+        {
+            if (!isJump(&code[i]))
+                continue;
+            t = code[i].mod;
+            for (hops = 0; t >= 0 && t < n && code[t].op == 7 && hops < n; hops++)
+                t = code[t].mod;                    //hops stops a loop of JMPs going round forever
+            code[i].mod = t;
+        }
+
+        memset(keep, 0, n + 1);                     //Mark what can run, starting from the first instruction
+        memset(jumpedTo, 0, n + 1);
+        j = 0;
+        work[j++] = 0;
+        while (j > 0)
+        {
+            i = work[--j];
+            if (i < 0 || i >= n || keep[i])
+                continue;
+            keep[i] = 1;
+            if (isJump(&code[i]))
+            {
+                work[j++] = code[i].mod;
+                if (code[i].mod >= 0 && code[i].mod <= n)
+                    jumpedTo[code[i].mod] = 1;
+            }
+            if (code[i].op == 7 || (code[i].op == 2 && code[i].mod == 0) || (code[i].op == 9 && code[i].mod == 2))
+                continue;                           //JMP, RET and HLT never carry on to the next instruction
+            work[j++] = i + 1;
+        }
+
+        for (i = 0; i + 1 < n; i++)                 //LOD x; STO x does nothing, unless something jumps to the STO
+        {
+            if (keep[i] && keep[i+1] && !jumpedTo[i+1] && code[i].op == 3 && code[i+1].op == 4
+                && code[i].lex == code[i+1].lex && code[i].mod == code[i+1].mod)
+            {
+                keep[i] = keep[i+1] = 0;
+                i++;
+            }
+        }
+
+        for (i = n - 1; i >= 0; i--)                //A JMP to whatever runs next anyway. Backwards, so a JMP behind one we drop sees it gone
+        {
+            if (!keep[i] || code[i].op != 7)
+                continue;
+            for (j = i + 1; j < n && !keep[j]; j++)
+                ;
+            if (code[i].mod > i && code[i].mod <= j)
+                keep[i] = 0;
+        }
+
+        for (i = 0, j = 0; i < n; i++)              //Where each instruction ends up. A dropped one's is the next one kept
+        {
+            newIndex[i] = j;
+            j += keep[i];
+        }
+        newIndex[n] = j;
+
+        removed = n - j;
+        for (i = 0; i < entryCount; i++)
+        {
+            if (entries[i] >= 0 && entries[i] < n)
+                entries[i] = keep[entries[i]] ? newIndex[entries[i]] : -1;
+        }
+        for (i = 0, j = 0; i < n; i++)              //Close up the program, pointing every jump at its target's new place
+        {
+            if (!keep[i])
+                continue;
+            if (isJump(&code[i]) && code[i].mod >= 0 && code[i].mod <= n)
+                code[i].mod = newIndex[code[i].mod];
+            code[j++] = code[i];
+        }
+        n = j;
+    } while (removed > 0);
+
+    out->count = n;
+    free(work);
+    free(newIndex);
+    free(keep);
+    free(jumpedTo);
+}
+
+static int isJump(command *instruction)
+{
+    return instruction->op == 5 || instruction->op == 7 || instruction->op == 8 || (instruction->op >= 10 && instruction->op <= 15) || instruction->op == 24;
+}
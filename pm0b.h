@@ -0,0 +1,45 @@
+#ifndef PM0B_H_INCLUDED
+#define PM0B_H_INCLUDED
+
+#include <stdint.h>
+
+/**
+ *  PM0B, the binary form of a PM/0 program, for the VM to load without
+ *  parsing any text. The text .pm0 is still the one to read or trade.
+ *
+ *  A file is, one after the other:
+ *
+ *  header      a pm0bHeader, 32 bytes
+ *  code        count instructions, each op, l and m as 32 bit ints
+ *  procedures  procedureCount pm0bProcedures
+ *  names       namesSize bytes of procedure names, each ending in a 0
+ *
+ *  Everything is in the byte order of the machine that wrote it, a file
+ *  from a machine of the other order fails the version check. The code is
+ *  laid out just like an array of instructions in memory, so the VM maps
+ *  the file and runs it where it is.
+ */
+#define PM0B_MAGIC "PM0B"
+#define PM0B_VERSION 1
+#define PM0B_EXTENDED 1         // In flags if the program uses the fused instructions, see compiler.h
+
+typedef struct pm0bHeader
+{
+    char magic[4];              // PM0B_MAGIC, not null terminated
+    int32_t version;            // PM0B_VERSION
+    int32_t flags;
+    int32_t entry;              // Address of the first instruction to run
+    int32_t count;              // Instructions in the code
+    int32_t procedureCount;     // Entries in the procedure table
+    int32_t namesSize;          // Bytes of names after the procedure table
+    int32_t reserved;           // 0
+} pm0bHeader;
+
+typedef struct pm0bProcedure
+{
+    int32_t entry;              // Address of the procedure's first instruction, -1 if nothing calls it and it was taken out
+    int32_t level;              // Lex level its body runs at
+    int32_t name;               // Where its name starts in the names
+} pm0bProcedure;
+
+#endif // PM0B_H_INCLUDED
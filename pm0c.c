@@ -0,0 +1,460 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pm0b.h"
+
+/**
+ *  pm0c, which translates a PM/0 program into C, so a C compiler can turn it
+ *  into a native program instead of the VM interpreting it.
+ *
+ *      pm0c program output.c [-stack N] [-build executable]
+ *
+ *  The program is text .pm0 or PM0B, just like the VM takes. Every
+ *  instruction becomes a label, L and its address, and the statement that
+ *  does what the VM does for it. Jumps and calls become gotos. RET is the
+ *  only jump whose target isn't known until it runs, and it goes through a
+ *  switch over every address, which is also how the program starts.
+ *
+ *  The translation keeps everything about a run the way the VM has it: the
+ *  same stack of MAX_STACK_HEIGHT slots, or N with -stack N like the VM's
+ *  option, the same four slot activation record CAL builds, frames found
+ *  through the display and base() past the main block's, and the same
+ *  checks and error messages. Only INC and CAL are checked against the top
+ *  of the stack though, a push past it isn't caught the way the VM's guard
+ *  page catches it. OUT prints what "vm program -fast" prints, and division
+ *  by 0 raises SIGFPE just like the VM dies of, so the two can be compared
+ *  run for run. Arithmetic wraps around like the VM's does, the translation
+ *  never relies on the C compiler to do that.
+ *
+ *  "-build executable" compiles the translation with $CC, gcc if that
+ *  isn't set, at -O2.
+ */
+#define MAX_STACK_HEIGHT 2000   // The VM's, see vm.c
+#define MAX_STACK_LIMIT (1<<28) // And the most its -stack can ask for
+
+typedef struct pm0Instruction
+{
+    int op;
+    int l;
+    int m;
+} pm0Instruction;
+
+typedef struct pm0Code
+{
+    pm0Instruction *code;
+    int count;
+    int capacity;
+    int entry;              // Address of the first instruction to run
+} pm0Code;
+
+/**
+ *  What every translation starts with. FRAME, CALL and RET are
+ *  frame(), callProcedure() and returnFromProcedure() of vm.c, as macros
+ *  over main's registers so the C compiler can keep those in its own.
+ */
+static const char *prelude[] =
+{
+    "#include <stdio.h>",
+    "#include <stdlib.h>",
+    "#include <limits.h>",
+    "#include <signal.h>",
+    "",
+    "#define MAX_STACK_HEIGHT %d",
+    "#define MAX_CALL_DEPTH (MAX_STACK_HEIGHT/4)",
+    "",
+    "#define WRAP(a, op, b) ((int)((unsigned)(a) op (unsigned)(b)))",
+    "#define FRAME(l) ((l) >= 0 && (l) <= curLevel ? display[curLevel - (l)] : base((l), bp))",
+    "#define CALL(l, m, ret) do { \\",
+    "        if ((l) < 0 || (l) > curLevel + 1 || callDepth == MAX_CALL_DEPTH) \\",
+    "            cannotCall((l), (m), curLevel, callDepth); \\",
+    "        if (sp + 4 > MAX_STACK_HEIGHT) \\",
+    "            stackOverflow(\"CAL\", (l), (m), (ret) - 1); \\",
+    "        stack[sp + 1] = 0; \\",
+    "        stack[sp + 2] = FRAME(l); \\",
+    "        stack[sp + 3] = bp; \\",
+    "        stack[sp + 4] = (ret); \\",
+    "        bp = sp + 1; \\",
+    "        calls[callDepth].level = curLevel; \\",
+    "        curLevel = curLevel + 1 - (l); \\",
+    "        calls[callDepth].saved = display[curLevel]; \\",
+    "        callDepth++; \\",
+    "        display[curLevel] = bp; \\",
+    "    } while (0)",
+    "#define RET() do { \\",
+    "        sp = bp - 1; \\",
+    "        pc = stack[sp + 4]; \\",
+    "        bp = stack[sp + 3]; \\",
+    "        if (callDepth > 0) \\",
+    "        { \\",
+    "            callDepth--; \\",
+    "            display[curLevel] = calls[callDepth].saved; \\",
+    "            curLevel = calls[callDepth].level; \\",
+    "        } else \\",
+    "            display[curLevel] = bp; \\",
+    "    } while (0)",
+    "",
+    "static int stack[MAX_STACK_HEIGHT + 1];",
+    "static int display[MAX_CALL_DEPTH + 1];",
+    "static struct { int level, saved; } calls[MAX_CALL_DEPTH];",
+    "",
+    "static inline int base(int level, int b)",
+    "{",
+    "    while (level > 0)",
+    "    {",
+    "        b = stack[b + 1];",
+    "        level--;",
+    "    }",
+    "    return b;",
+    "}",
+    "",
+    "static inline void cannotCall(int l, int m, int curLevel, int callDepth)",
+    "{",
+    "    printf(\"\\nCAL %%d %%d can't be made from lex level %%d at call depth %%d\\nExiting Program ...\\n\", l, m, curLevel, callDepth);",
+    "    exit(1);",
+    "}",
+    "",
+    "static inline void stackOverflow(const char *op, int l, int m, int addr)",
+    "{",
+    "    printf(\"\\n%%s %%d %%d at %%d runs off the top of the stack, which has %%d slots\\nExiting Program ...\\n\", op, l, m, addr, MAX_STACK_HEIGHT);",
+    "    exit(1);",
+    "}",
+    "",
+    "static inline int divide(int a, int b)",
+    "{",
+    "    if (b == 0 || (b == -1 && a == INT_MIN))",
+    "    {",
+    "        raise(SIGFPE);",
+    "        return 0;",
+    "    }",
+    "    return a / b;",
+    "}",
+    "",
+    "static inline int modulo(int a, int b)",
+    "{",
+    "    if (b == 0 || (b == -1 && a == INT_MIN))",
+    "    {",
+    "        raise(SIGFPE);",
+    "        return 0;",
+    "    }",
+    "    return a %% b;",
+    "}",
+    "",
+    "static inline void readNumber(int *to)",
+    "{",
+    "    int read = scanf(\"%%d\", to);",
+    "    (void)read;",
+    "}",
+    "",
+    "int main(void)",
+    "{",
+    "    int sp = 0, bp = 1, pc, curLevel = 0, callDepth = 0;",
+    "",
+    "    display[0] = bp;",
+    "    (void)calls;                /* Not every program calls */",
+    "    (void)callDepth;",
+    NULL
+};
+
+static const char *oprNames[] = {"RET", "NEG", "ADD", "SUB", "MUL", "DIV", "ODD", "MOD", "EQL", "NEQ", "LSS", "LEQ", "GTR", "GEQ"};
+static const char *opNames[] = {"", "LIT", "OPR", "LOD", "STO", "CAL", "INC", "JMP", "JPC", "SIO", "JEQ", "JNE", "JLT", "JLE",
+                                "JGT", "JGE", "LADD", "LSUB", "LMUL", "LDIV", "IADD", "ISUB", "IMUL", "IDIV", "JNZ"};
+static const char *sioNames[] = {"OUT", "INP", "HLT"};
+static const char *relations[] = {"==", "!=", "<", "<=", ">", ">="};       // JEQ to JGE, and OPR EQL to GEQ
+static const char *operators[] = {"+", "-", "*", "/"};                      // LADD to LDIV and IADD to IDIV
+
+static int loadProgram(const char *fileName, pm0Code *program);
+static int loadBinary(FILE *in, pm0Code *program);
+static int translate(const pm0Code *program, const char *fileName, int stackHeight, FILE *out);
+static void translateInstruction(const pm0Code *program, int addr, FILE *out);
+static void writeTarget(const pm0Code *program, int target, FILE *out);
+static const char *mnemonic(pm0Instruction in, char name[16]);
+
+int main(int argc, char **argv)
+{
+    pm0Code program = {0};
+    char *builtName = NULL, *cc, *command;
+    FILE *out;
+    int i, failed, stackHeight = MAX_STACK_HEIGHT;
+
+    for (i = 3; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-build") == 0 && i + 1 < argc)
+            builtName = argv[++i];
+        else if (strcmp(argv[i], "-stack") == 0 && i + 1 < argc && (stackHeight = atoi(argv[++i])) >= 4 && stackHeight <= MAX_STACK_LIMIT)
+            ;
+        else
+        {
+            printf("Bad option %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (argc < 3)
+    {
+        printf("Usage: pm0c program output.c [-stack N] [-build executable]\n");
+        return 1;
+    }
+
+    if (loadProgram(argv[1], &program))
+        return 1;
+    out = fopen(argv[2], "w");
+    if (out == NULL)
+    {
+        printf("Error opening %s\n", argv[2]);
+        free(program.code);
+        return 1;
+    }
+    failed = translate(&program, argv[1], stackHeight, out);
+    if (fclose(out) != 0 || failed)
+    {
+        printf("Error writing %s\n", argv[2]);
+        free(program.code);
+        return 1;
+    }
+    free(program.code);
+
+    if (builtName == NULL)
+        return 0;
+    cc = getenv("CC");
+    if (cc == NULL || *cc == '\0')
+        cc = "gcc";
+    command = malloc(strlen(cc) + strlen(argv[2]) + strlen(builtName) + 32);
+    if (command == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    sprintf(command, "%s -O2 -o \"%s\" \"%s\"", cc, builtName, argv[2]);
+    failed = system(command) != 0;
+    if (failed)
+        printf("%s failed\n", command);
+    free(command);
+    return failed;
+}
+
+/**
+ *  Reads the program in fileName, PM0B if it starts with the magic and text
+ *  otherwise. Returns 0 on success, prints what went wrong and returns 1 if
+ *  it couldn't, with nothing left allocated. A program with no instructions
+ *  is refused, the same as the VM refuses it.
+ */
+static int loadProgram(const char *fileName, pm0Code *program)
+{
+    FILE *in = fopen(fileName, "rb");
+    char magic[4];
+    pm0Instruction instruction;
+    int failed = 0;
+
+    if (in == NULL)
+    {
+        printf("Error opening %s\n", fileName);
+        return 1;
+    }
+    if (fread(magic, 1, 4, in) == 4 && memcmp(magic, PM0B_MAGIC, 4) == 0)
+    {
+        rewind(in);
+        failed = loadBinary(in, program);
+        if (failed)
+            printf("%s is not a PM0B file pm0c can translate\n", fileName);
+        fclose(in);
+        return failed;
+    }
+
+    rewind(in);
+    while (fscanf(in, "%d %d %d", &instruction.op, &instruction.l, &instruction.m) == 3)
+    {
+        if (program->count == program->capacity)
+        {
+            int capacity = program->capacity ? program->capacity * 2 : 512;
+            pm0Instruction *grown = realloc(program->code, capacity * sizeof(pm0Instruction));
+            if (grown == NULL)
+            {
+                printf("Out of memory loading %s\n", fileName);
+                failed = 1;
+                break;
+            }
+            program->code = grown;
+            program->capacity = capacity;
+        }
+        program->code[program->count++] = instruction;
+    }
+    fclose(in);
+    if (!failed && program->count == 0)
+    {
+        printf("%s has no instructions to run\n", fileName);
+        failed = 1;
+    }
+    if (failed)
+    {
+        free(program->code);
+        program->code = NULL;
+    }
+    return failed;
+}
+
+/**
+ *  Only the header and the code of a PM0B file matter here, the procedure
+ *  table is for debuggers.
+ */
+static int loadBinary(FILE *in, pm0Code *program)
+{
+    pm0bHeader header;
+    int32_t fields[3];
+    int i;
+
+    if (fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, PM0B_MAGIC, 4) != 0
+        || header.version != PM0B_VERSION || header.count < 0 || header.entry < 0 || header.entry >= header.count)
+        return 1;
+    program->code = malloc((header.count + 1) * sizeof(pm0Instruction));
+    if (program->code == NULL)
+        return 1;
+    for (i = 0; i < header.count; i++)
+    {
+        if (fread(fields, sizeof(fields), 1, in) != 1)
+        {
+            free(program->code);                    // Cut short
+            program->code = NULL;
+            return 1;
+        }
+        program->code[i].op = fields[0];
+        program->code[i].l = fields[1];
+        program->code[i].m = fields[2];
+    }
+    program->count = program->capacity = header.count;
+    program->entry = header.entry;
+    return 0;
+}
+
+/**
+ *  Writes the C for the whole program. Returns 1 if writing it failed.
+ */
+static int translate(const pm0Code *program, const char *fileName, int stackHeight, FILE *out)
+{
+    int i;
+
+    fprintf(out, "/* %s, translated from PM/0 by pm0c. %d instructions, starting at %d */\n\n",
+            fileName, program->count, program->entry);
+    for (i = 0; prelude[i] != NULL; i++)
+    {
+        fprintf(out, prelude[i], stackHeight);
+        fputc('\n', out);
+    }
+    fprintf(out, "    pc = %d;\n"
+                 "    goto dispatch;\n", program->entry);
+
+    for (i = 0; i < program->count; i++)
+        translateInstruction(program, i, out);
+
+    fprintf(out, "end:\n"
+                 "    return 0;\n"
+                 "dispatch:\n"
+                 "    switch (pc)\n"
+                 "    {\n");
+    for (i = 0; i < program->count; i++)
+        fprintf(out, "        case %d: goto L%d;\n", i, i);
+    fprintf(out, "        default: goto end;\n"
+                 "    }\n"
+                 "}\n");
+    return ferror(out) != 0;
+}
+
+/**
+ *  One instruction, doing exactly what executeCycle in vm.c does with it.
+ *  Running off the end of it goes on to the next address, like pc++ does.
+ */
+static void translateInstruction(const pm0Code *program, int addr, FILE *out)
+{
+    pm0Instruction in = program->code[addr];
+    char name[16];
+    int l = in.l, m = in.m;
+
+    fprintf(out, "L%d: /* %s %d %d */\n    ", addr, mnemonic(in, name), l, m);
+    switch (in.op)
+    {
+        case 1  : fprintf(out, "sp++; stack[sp] = %d;", m);
+                  break;
+        case 2  : if (m == 0)
+                      fprintf(out, "RET(); goto dispatch;");
+                  else if (m == 1)
+                      fprintf(out, "stack[sp] = WRAP(0, -, stack[sp]);");
+                  else if (m >= 2 && m <= 4)
+                      fprintf(out, "sp--; stack[sp] = WRAP(stack[sp], %s, stack[sp + 1]);", operators[m - 2]);
+                  else if (m == 5)
+                      fprintf(out, "sp--; stack[sp] = divide(stack[sp], stack[sp + 1]);");
+                  else if (m == 6)
+                      fprintf(out, "stack[sp] = stack[sp] & 1;");
+                  else if (m == 7)
+                      fprintf(out, "sp--; stack[sp] = modulo(stack[sp], stack[sp + 1]);");
+                  else if (m >= 8 && m <= 13)
+                      fprintf(out, "sp--; stack[sp] = stack[sp] %s stack[sp + 1];", relations[m - 8]);
+                  else
+                      fprintf(out, "printf(\"error executing OPR\\n\");");
+                  break;
+        case 3  : fprintf(out, "sp++; stack[sp] = stack[FRAME(%d) + %d];", l, m);
+                  break;
+        case 4  : fprintf(out, "stack[FRAME(%d) + %d] = stack[sp]; sp--;", l, m);
+                  break;
+        case 5  : fprintf(out, "CALL(%d, %d, %d); ", l, m, addr + 1);
+                  writeTarget(program, m, out);
+                  break;
+        case 6  : fprintf(out, "if (sp + %dLL > MAX_STACK_HEIGHT)\n        stackOverflow(\"INC\", %d, %d, %d);\n    ", m, l, m, addr);
+                  fprintf(out, "sp = WRAP(sp, +, %d);", m);
+                  break;
+        case 7  : writeTarget(program, m, out);
+                  break;
+        case 8  : fprintf(out, "sp--; if (stack[sp + 1] == 0) ");
+                  writeTarget(program, m, out);
+                  break;
+        case 9  : if (m == 0)
+                      fprintf(out, "printf(\"popped stack val: %%d\\n\", stack[sp]); sp--;");
+                  else if (m == 1)
+                      fprintf(out, "sp++; readNumber(&stack[sp]);");
+                  else if (m == 2)
+                      fprintf(out, "goto end;");
+                  else
+                      fprintf(out, "printf(\"SIO error\\n\");");
+                  break;
+        case 10 : case 11 : case 12 : case 13 : case 14 : case 15 :
+                  fprintf(out, "sp -= 2; if (stack[sp + 1] %s stack[sp + 2]) ", relations[in.op - 10]);
+                  writeTarget(program, m, out);
+                  break;
+        case 24 : fprintf(out, "sp--; if (stack[sp + 1] != 0) ");
+                  writeTarget(program, m, out);
+                  break;
+        case 16 : case 17 : case 18 :
+                  fprintf(out, "stack[sp] = WRAP(stack[sp], %s, stack[FRAME(%d) + %d]);", operators[in.op - 16], l, m);
+                  break;
+        case 19 : fprintf(out, "stack[sp] = divide(stack[sp], stack[FRAME(%d) + %d]);", l, m);
+                  break;
+        case 20 : case 21 : case 22 :
+                  fprintf(out, "stack[sp] = WRAP(stack[sp], %s, %d);", operators[in.op - 20], m);
+                  break;
+        case 23 : fprintf(out, "stack[sp] = divide(stack[sp], %d);", m);
+                  break;
+        default : fprintf(out, ";");            //The VM skips what it doesn't know
+                  break;
+    }
+    fputc('\n', out);
+}
+
+/**
+ *  A goto to target. Anywhere outside the program is where the VM stops.
+ */
+static void writeTarget(const pm0Code *program, int target, FILE *out)
+{
+    if (target >= 0 && target < program->count)
+        fprintf(out, "goto L%d;", target);
+    else
+        fprintf(out, "goto end;");
+}
+
+static const char *mnemonic(pm0Instruction in, char name[16])
+{
+    if (in.op == 2 && in.m >= 0 && in.m <= 13)
+        return oprNames[in.m];
+    if (in.op == 9 && in.m >= 0 && in.m <= 2)
+        return sioNames[in.m];
+    if (in.op >= 1 && in.op <= 24)
+        return opNames[in.op];
+    sprintf(name, "op %d", in.op);
+    return name;
+}
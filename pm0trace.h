@@ -0,0 +1,52 @@
+#ifndef PM0TRACE_H_INCLUDED
+#define PM0TRACE_H_INCLUDED
+
+#include <stdint.h>
+
+/**
+ *  PM0T, a binary record of a run of the VM. The VM writes it with -trace
+ *  and renders it back with -render, in the same format it traces to the
+ *  screen.
+ *
+ *  A file is a pm0tHeader, 40 bytes, and then count pm0tRecords of 48 bytes,
+ *  one for each step the trace kept, in the order they ran. Like PM0B
+ *  it is in the byte order of the machine that wrote it.
+ *
+ *  Which steps have records depends on how the trace was taken: every
+ *  sample-th step, of those only the ones at addresses pcLow to pcHigh, and
+ *  of those only the last ones if it went to a ring buffer that wrapped. A
+ *  trace that kept every step is complete, and everything the run did can
+ *  be worked out again from it and the program.
+ */
+#define PM0T_MAGIC "PM0T"
+#define PM0T_VERSION 1
+#define PM0T_COMPLETE 1         // In flags if every step of the run has its record
+#define PM0T_WRAPPED 2          // In flags if a ring buffer overflowed and only the last records are left
+
+typedef struct pm0tHeader
+{
+    char magic[4];              // PM0T_MAGIC, not null terminated
+    int32_t version;            // PM0T_VERSION
+    int32_t flags;
+    int32_t sample;             // A record was kept for every sample-th step
+    int32_t pcLow;              // And only for steps at addresses pcLow to pcHigh
+    int32_t pcHigh;
+    int64_t steps;              // Steps the run took
+    int64_t count;              // Records in the file
+} pm0tHeader;
+
+typedef struct pm0tRecord
+{
+    int64_t step;               // Counting from 0
+    int32_t addr;               // Address of the instruction
+    int32_t op;
+    int32_t l;
+    int32_t m;
+    int32_t pc;                 // The registers after it ran
+    int32_t bp;
+    int32_t sp;
+    int32_t top;                // stack[sp] after it ran, which for INP is what was read
+    int32_t reserved[2];        // 0, and makes a record 48 bytes
+} pm0tRecord;
+
+#endif // PM0TRACE_H_INCLUDED
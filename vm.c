@@ -1 +1,1900 @@
-// Team name:  Compiler Builder 11//// Emily ["Mel"] Pelchat// Hunter Pierce// Jacob Hazelbaker// Jessica ["Kika"] Wingert#include <stdio.h>#include <stdlib.h>#define MAX_STACK_HEIGHT 2000#define MAX_CODE_LENGTH 500#define MAX_LEXI_LEVELS 3typedef struct{ int op; int l; int m;}instr;/// global variables ftwchar *opcodes[] = {"", "LIT", "OPR", "LOD", "STO", "CAL", "INC", "JMP", "JPC", "SIO"}; //stolen from Hunterchar *opcodesSIO[] = {"OUT", "INP", "HLT"};char *opcodesOPR[] = {"RET", "NEG", "ADD", "SUB", "MUL", "DIV", "ODD", "MOD", "EQL", "NEQ", "LSS", "LEQ", "GTR", "GEQ"};int bp = 1;int sp = 0;int pc = 0;instr ir;int stack[MAX_STACK_HEIGHT+1];instr code[MAX_CODE_LENGTH];int codeSize=-1;FILE *fp;///FILE *ofp;///void write_Stack(int bp, int sp);void printCode();void fetchCycle();void executeCycle();void printHeading();///void printStateF();void printStateE();void printStack();///void printStackAR();int halt();int base(int level, int b);int main(int argc, char * argv[]){ stack[1] = 0; stack[2] = 0; stack[3] = 0;  /*** ///open files fp = fopen("test.txt", "r"); ///ofp = fopen("testout.txt", "w"); if(fp==NULL) //|| ofp==NULL)      printf("error opening file\n");      ***/     fp = fopen(argv[1], "r");       // open the input file    ///ofp = fopen("trace.txt", "w");  // open the output file if(fp==NULL) {        printf("Error opening input file %s\nExiting Program ...\n", argv[1]);        return -1;    }    ///if (ofp == NULL) {       /// printf("Error opening output file\nExiting Program ...\n");        ///return -1;   ///read fp into code[]   int lines;      //num lines in fp while(!feof(fp)){      for(lines=0; lines<MAX_CODE_LENGTH; lines++){         fscanf(fp, "%d %d %d", &code[lines].op, &code[lines].l, &code[lines].m);         if(feof(fp)){            codeSize = lines+1;   /// lines is now also equal to instruction number            break;         }      }      ///print pl/0 code      printf("PL/0 code:\n\n");  printCode(); }   ///print execution   printHeading();   do{    fetchCycle();    //printStateF();    executeCycle();    printStateE();    //write_Stack(bp, sp);    printStack();   } while(!halt()); fclose(fp); ///fclose(ofp); return 0;}void write_Stack(int bp, int sp){    // TO DO - Write the contents of the stack to output_file    int i;    if (bp > 1) {        write_Stack(stack[bp+2], bp-1);        if (bp<sp)            printf("| ");        for (i = bp; i <= sp; i++) {            printf("%d ", stack[i]);        }        printf("\n");    }    else {        for (i=bp; i<=sp; i++)        {            printf("%d ", stack[i]);        }    }    printf("\n");}void printCode(){  int i;   for(i=0; i<codeSize-1; i++){   switch(code[i].op){    /// LIT __  M    case 1:     printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);     break;    /// OPR    case 2:       if(code[i].m == 0)                  printf("%3d  %s\n", i, opcodesOPR[code[i].m]);     else                  printf("%3d  %s%5d%5d\n", i, opcodesOPR[code[i].m], code[i].l, code[i].m);     break;     //switch(ir.m){      /// RET __ __      //case 0:       //printf("%3d  %s\n", i, opcodesOPR[code[i].m]);      ///     //}    /// LOD L M    case 3:     printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);     break;    /// STO L M    case 4:     printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);     break;    /// CAL L M    case 5:     printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);     break;    /// INC __ M    case 6:     printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);     break;    /// JMP __ M    case 7:     printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);     break;    ///??????????? JPC __ M ?????????    case 8:     printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);     break;    /// SIO    case 9:     if(code[i].m == 2)      printf("%3d  %s\n", i, opcodesSIO[code[i].m]);     else                  printf("%3d  %s %9d\n", i, opcodesSIO[code[i].m], code[i].m);     break;    default:     ;   }  }  printf("\n");   /*     if (code[i].op == 2)       printf("%3d  %s%5d%5d\n", i, opcodesOPR[code[i].m], code[i].l, code[i].m);       if (code[i].op == 9)       printf("%3d  %s\n", i, opcodesSIO[code[i].m]);       else         printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);   }   printf("\n");*/}void printHeading(){ printf("Execution:\n"); printf("                      pc   bp   sp   stack\n"); printf("%24d%5d%5d  \n", pc, bp, sp);}///print state of machine after fetch cyclevoid printStateF(){   switch(ir.op){      case 2:         printf("%3d  %s%5d%5d\n", pc-1, opcodesOPR[ir.m], ir.l, ir.m);      case 9:         switch(ir.m){            case 2:               printf("%3d  %s\n", pc-1, opcodesSIO[ir.m]);            default:               printf("%3d  %s%5d%5d\n", pc-1, opcodesSIO[ir.m], ir.l, ir.m);         }      default:         ; //printf("%3d  %s%5d%5d", pc-1, opcodes[ir.op], ir.l, ir.m);   }}/// print state of machine after execute cyclevoid printStateE(){   if(sp==0 || bp==1)      printf("%6d%5d%5d", pc, bp, sp);   else      printf("%6d%5d%5d", pc, bp, sp);}void printStack(){ int i, bp_copy=bp; printf("   ");   /*if(sp==0){   } else if(bp_copy==1){      for (i=1; i<=sp; i++)         printf("%d ", stack[i]); } for (i=1; i<=bp_copy; i++)      printf("%d ", stack[i]); if(bp_copy>1){      if(bp_copy<sp){         printf(" | ");      for (i=bp_copy; i<=sp; i++)         printf("%d ", stack[i]);      } }//      if(bp==1)//         break;*/    if(bp_copy==1 && sp!=0){      for(i=1; i<=sp; i++)        printf("%d ", stack[i]);    }   else if(bp_copy>1){      for(i=1; i<bp_copy; i++)        printf("%d ", stack[i]);      if(bp_copy<sp)         printf("| ");      for(i=bp_copy; i<=sp; i++)         printf("%d ", stack[i]); } printf("\n");}void printStackAR(){ int i = 1; printf("  "); for (i=2; i<=sp; i++)  printf("%2d", stack[i]); printf(" |");}void fetchCycle(){   ir = code[pc];   pc++;   //printf("%d fetched\n", ir.op);}void executeCycle(){ switch(ir.op){  // 01 LIT 0 M  push m onto stack  case 1:      //printf("executing LIT\n");            printf("%3d  %s %9d", pc-1, opcodes[ir.op], ir.m);            sp = sp + 1;   stack[sp] = ir.m;   break;  // 02 OPR 0 M  case 2:            //printf("executing OPR\n");            //printf("%3d  %s%5d%5d\n", pc-1, opcodesOPR[ir.m], ir.l, ir.m);            printf("%3d  %s  \t  ", pc-1, opcodesOPR[ir.m]);            switch(ir.m){      /// RET            case 0:               sp = bp-1;               pc = stack[sp+4]; //4               bp = stack[sp+3]; //3               break;            /// NEG            case 1:               stack[sp] = -stack[sp];               break;            ///ADD            case 2:               sp = sp-1;               stack[sp] = stack[sp] + stack[sp+1];               break;            /// SUB            case 3:               sp = sp-1;               stack[sp] = stack[sp] - stack[sp+1];               break;            /// MUL            case 4:               sp = sp-1;               stack[sp] = stack[sp] * stack[sp+1];               break;            /// DIV            case 5:               sp = sp-1;               stack[sp] = stack[sp] / stack[sp+1];               break;            /// ODD            case 6:               stack[sp] = stack[sp] & 1;               break;            /// MOD            case 7:               sp = sp-1;               stack[sp] = stack[sp] % stack[sp+1];               break;            /// EQL            case 8:               sp = sp-1;               stack[sp] = stack[sp] == stack[sp+1];               break;            /// NEQ            case 9:               sp = sp-1;               stack[sp] = stack[sp] != stack[sp+1];               break;            /// LSS            case 10:               sp = sp-1;               stack[sp] = stack[sp] < stack[sp+1];               break;            /// LEQ            case 11:               sp = sp-1;               stack[sp] = stack[sp] <= stack[sp+1];               break;            /// GTR            case 12:               sp = sp-1;               stack[sp] = stack[sp] > stack[sp+1];               break;            /// GEQ            case 13:               sp = sp-1;               stack[sp] = stack[sp] >= stack[sp+1];               break;            default:               printf("error executing OPR\n");     }   break;  // 03 LOD L M  push stack value of offset M in frame L levels down  case 3:            //printf("executing LOD\n");            printf("%3d  %s%5d%5d", pc-1, opcodes[ir.op], ir.l, ir.m);   sp = sp + 1;   stack[sp] = stack[base(ir.l, bp) + ir.m];   break;  // 04 STO L M  pop stack, insert val at offset M in frame L levels down  case 4:            //printf("executing STO\n");            printf("%3d  %s%5d%5d", pc-1, opcodes[ir.op], ir.l, ir.m);   stack[base(ir.l, bp) + ir.m] = stack[sp];   sp--;   //if(sp>0)    //sp--;   break;  // 05 CAL L M Call procedure at M  case 5:            //printf("executing CAL\n");            printf("%3d  %s%5d%5d", pc-1, opcodes[ir.op], ir.l, ir.m);            //printStackAR();   stack[sp+1] = 0;       // return value   stack[sp+2] = base(ir.l, bp);          //static link   stack[sp+3] = bp;       //dynamic link   stack[sp+4] = pc;       // return address   bp = sp+1;   pc = ir.m;   //printStack();   break;  // 06 INC 0 M  allocate m locals on stack  case 6:            //printf("executing INC\n");            printf("%3d  %s %9d", pc-1, opcodes[ir.op], ir.m);          /*if(sp == 0){        // What is this for?            sp = ir.m + 1;      // We add M to 0, and then add 1     sp--;               // only to subtract 1 after? This makes no sense.            }            else */            sp = sp + ir.m;     // Just add sp to M and be done with it. Both if branches ended up doing exactly the same thing.            break;  // 07 JMP 0 M  jump to M  case 7:            //printf("executing JMP\n");            //printf("%10d", ir.m);            printf("%3d  %s %9d", pc-1, opcodes[ir.op], ir.m);   pc = ir.m;      //NOOOO! Not sp+ This is not opr 6, it's 7... This is Jump. You jump to M, not to M+sp No wonder we seg faulted!   break;  // 08 JPC   pop stack, jump to m  case 8:            //printf("executing JPC\n");            printf("%3d  %s %9d", pc-1, opcodes[ir.op], ir.m);   if(stack[sp] == 0)    pc = ir.m;   sp = sp-1;   break;  // 09 SIO  case 9:            //printf("executing SIO\n");            //printf("executing SIO\n");            //printf("%3d  %s%5d%5d\n", pc-1, opcodesSIO[ir.m], ir.l, ir.m);   switch(ir.m){    // pop stack    case 0:     printf("%3d  %s %9d", pc-1, opcodesSIO[ir.m], ir.m);     printf("popped stack val: %d\n", stack[sp]);     sp = sp-1;     break;    // push user input    case 1:     printf("%3d  %s %9d", pc-1, opcodesSIO[ir.m], ir.m);     sp = sp+1;     scanf("%d", &(stack[sp]));     break;    // halt    case 2:     printf("%3d  %s \t  ", pc-1, opcodesSIO[ir.m]);                    //printf("halting...\n");                    /*printf("%3d  %s\n", pc-1, opcodesSIO[ir.m]);   */     break;    default:     printf("SIO error\n");    }  // default  default:   //printf("exec error\n");      ; }  //printState(ir);}int halt(){   if(ir.op == 9 && ir.m == 2)      return 1;  if (pc >= codeSize)    return 1;  if(pc == MAX_CODE_LENGTH)    return 1;   return 0;}int base(int level, int b){   while(level>0){      b = stack[b+1];      level--;   }   return b;}/**bp>1  write_Stack(output_file, stack[bp+2], bp-1};bp<sp  print |  printstackelsebp<spprintStack**/
+// Team name:  Compiler Builder 11
+//
+// Emily ["Mel"] Pelchat
+// Hunter Pierce
+// Jacob Hazelbaker
+// Jessica ["Kika"] Wingert
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <signal.h>
+#include <time.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "pm0b.h"
+#include "pm0trace.h"
+
+#define MAX_STACK_HEIGHT 2000                   // slots the stack has unless -stack says otherwise
+#define MAX_STACK_LIMIT (1<<28)                 // the most -stack can ask for, a gigabyte
+#define MAX_LEXI_LEVELS 3
+#define TRACE_BUFFER 4096                       // records -trace holds before writing them out
+#define BENCH_RUNS 3                            // -bench times each engine this many times and keeps the best
+
+/// gcc can jump to a label whose address it's given, that's what makes the pre-decoded engine threaded.
+/// Build with -DVM_SWITCH to try its switch on gcc as well
+#if defined(__GNUC__) && !defined(VM_SWITCH)
+#define VM_THREADED
+#endif
+
+/// the JIT writes x86-64 and needs mmap to have somewhere to run it. Build with -DVM_NO_JIT to leave it out
+#if defined(__x86_64__) && !defined(_WIN32) && !defined(VM_NO_JIT)
+#define VM_JIT
+#endif
+
+typedef struct
+{
+    int op;
+    int l;
+    int m;
+}instr;
+
+/// global variables ftw
+char *opcodes[] = {"", "LIT", "OPR", "LOD", "STO", "CAL", "INC", "JMP", "JPC", "SIO", //stolen from Hunter
+                   "JEQ", "JNE", "JLT", "JLE", "JGT", "JGE",        // extended ISA, fused compare and jump
+                   "LADD", "LSUB", "LMUL", "LDIV",                  // LOD then OPR
+                   "IADD", "ISUB", "IMUL", "IDIV",                  // LIT then OPR
+                   "JNZ"};                                          // JPC the other way round, for loops tested at the bottom
+char *opcodesSIO[] = {"OUT", "INP", "HLT"};
+char *opcodesOPR[] = {"RET", "NEG", "ADD", "SUB", "MUL", "DIV", "ODD", "MOD", "EQL", "NEQ", "LSS", "LEQ", "GTR", "GEQ"};
+int bp = 1;
+int sp = 0;
+int pc = 0;
+instr ir;
+int *stack;         // stack[0] to stack[stackHeight], see reserveStack()
+int stackHeight = MAX_STACK_HEIGHT;
+char *stackGuard = NULL;    // the page right after stack[stackHeight], touching it is running off the top
+size_t stackGuardSize = 0;
+char stackFull[128];        // what stackOnSignal() writes, made up by reserveStack() since a handler can't printf
+int stackFullLength = 0;
+instr *code;        // grows to fit whatever program we load
+int codeSize=0;     // number of instructions in code[]
+int codeCap=0;      // number of instructions code[] has room for
+char *mapped=NULL;  // the whole PM0B file when that's what we loaded, code[] points into it
+size_t mappedSize=0;
+FILE *fp;
+///FILE *ofp;
+
+/// the display: display[k] is the base of the frame at lex level k on the static chain of the running procedure,
+/// so LOD/STO L M go straight to display[curLevel-L] instead of walking L static links
+typedef struct
+{
+    int level;      // curLevel of the caller
+    int saved;      // what display[] held at the callee's level before the call
+}callRecord;
+int *display;
+int curLevel = 0;
+callRecord *calls;
+int callDepth = 0;
+int maxCallDepth;   // stackHeight/4, every frame takes at least the 4 slots of its activation record
+
+/// a binary trace on its way to a file, see pm0trace.h
+typedef struct
+{
+    FILE *out;          // unbuffered, so a signal handler can finish the file with write() on fd
+    int fd;
+    pm0tHeader header;
+    pm0tRecord *buffer;
+    int size;           // records buffer has room for
+    int ring;           // 1 if only the last size records are kept, otherwise buffer is written out whenever it fills
+    long long kept;     // records made so far
+    long long written;  // of those, the ones already in the file
+}tracer;
+/// the handlers of the pre-decoded engine, see runDecoded(). OPR's run from RET to GEQ in the order of their M,
+/// and SIO's from OUT to HLT
+#define VM_HANDLERS X(LIT) X(RET) X(NEG) X(ADD) X(SUB) X(MUL) X(DIV) X(ODD) X(MOD) X(EQL) X(NEQ) X(LSS) X(LEQ) X(GTR) X(GEQ) \
+                    X(BADOPR) X(LOD0) X(LOD) X(STO0) X(STO) X(CAL) X(INC) X(JMP) X(JPC) X(JNZ) \
+                    X(JEQ) X(JNE) X(JLT) X(JLE) X(JGT) X(JGE) X(LADD) X(LSUB) X(LMUL) X(LDIV) X(IADD) X(ISUB) X(IMUL) X(IDIV) \
+                    X(OUT) X(INP) X(HLT) X(BADSIO) X(NOP) X(END)
+#define X(name) T_##name,
+enum {VM_HANDLERS T_COUNT};
+#undef X
+
+typedef struct
+{
+#ifdef VM_THREADED
+    const void *handler;    // address of the label that runs it
+#else
+    int handler;            // T_ number of the case that runs it
+#endif
+    int l;
+    int m;                  // for a jump, where it goes, with anywhere outside the program made one past the end
+}decoded;
+
+/// the engines, see runEngine()
+#define ENGINE_SWITCH 0         // fetchCycle() and executeCycle(), the one that traces
+#define ENGINE_DECODED 1        // runDecoded()
+#define ENGINE_JIT 2            // runJit()
+#ifdef VM_JIT
+#define ENGINE_COUNT 3
+#else
+#define ENGINE_COUNT 2
+#endif
+char *engineNames[] = {"switch", "decoded", "jit"};
+
+int entry = 0;          // where the program starts
+int quiet = 0;          // 1 while -bench runs the program, OUT doesn't print
+int *inputs = NULL;     // what -bench read from stdin for INP to take, each run the same
+int inputCount = 0;
+int inputNext = 0;
+int *outputs = NULL;    // what -diff keeps of what OUT printed, to compare the engines by
+int outputCount = 0;
+int outputCap = 0;
+long long steps = 0;    // instructions run so far, only counted when tracing or rendering
+int replaying = 0;      // 1 while rendering a trace, INP takes what the traced run read instead of reading
+int replayInput;
+tracer *openTrace = NULL;   // closed on the way out even if the program dies part way
+
+///
+void write_Stack(int bp, int sp);
+void printCode();
+void fetchCycle();
+void executeCycle();
+void printHeading();
+void printStateE();
+void printStack();
+///void printStackAR();
+int halt();
+int base(int level, int b);
+int frame(int level);
+int compare(int rel, int a, int b);
+int arith(int opr, int a, int b);
+int loadBinary(const char *fileName);
+void printStep(int addr, instr in);
+int traceOpen(tracer *t, const char *fileName, int ring, int sample, int pcLow, int pcHigh);
+void traceStep(tracer *t, int addr);
+long long traceFinish(tracer *t, long long *start);
+int traceClose(tracer *t);
+void traceAtExit();
+void traceOnCrash();
+void traceOnSignal(int sig);
+int renderTrace(const char *fileName);
+void callProcedure(int l, int m, int ret);
+int returnFromProcedure();
+void writeNumber(int n);
+void readNumber(int *to);
+void runDecoded();
+int decodeKind(instr in);
+void resetVM();
+int runJit();
+void runEngine(int e);
+int engineNamed(const char *name);
+void readInputs();
+void benchmark();
+int differ();
+void *reserve(size_t bytes, char **guard);
+int reserveStack();
+void clearStack();
+void stackOverflow(int addr);
+#ifndef _WIN32
+void stackOnSignal(int sig, siginfo_t *info, void *context);
+#endif
+
+int main(int argc, char * argv[])
+{
+    int fast = 0, bench = 0, diff = 0, engine = ENGINE_DECODED, ring = 0, sample = 1, pcLow = 0, pcHigh = -1, i;
+    char *traceName = NULL, *renderName = NULL;
+    tracer trace;
+
+    /// after the program: -fast runs it without the trace, on the pre-decoded engine unless -engine says switch or jit,
+    /// -trace file records the trace there instead of printing it, keeping only the last -ring N steps, every
+    /// -sample N'th step, or the steps at addresses -pc lo-hi, -render file prints a trace recorded earlier the way it
+    /// would have been printed, -bench times every engine on the program and -diff checks they all agree on it.
+    /// -stack N gives the stack N slots instead of MAX_STACK_HEIGHT, for programs that recurse deep
+    for(i=2; i<argc; i++){
+        if(strcmp(argv[i], "-fast") == 0)
+            fast = 1;
+        else if(strcmp(argv[i], "-engine") == 0 && i+1 < argc && (engine = engineNamed(argv[++i])) >= 0)
+            ;
+        else if(strcmp(argv[i], "-bench") == 0)
+            bench = 1;
+        else if(strcmp(argv[i], "-diff") == 0)
+            diff = 1;
+        else if(strcmp(argv[i], "-trace") == 0 && i+1 < argc)
+            traceName = argv[++i];
+        else if(strcmp(argv[i], "-ring") == 0 && i+1 < argc && (ring = atoi(argv[++i])) > 0)
+            ;
+        else if(strcmp(argv[i], "-sample") == 0 && i+1 < argc && (sample = atoi(argv[++i])) > 0)
+            ;
+        else if(strcmp(argv[i], "-pc") == 0 && i+1 < argc && sscanf(argv[++i], "%d-%d", &pcLow, &pcHigh) == 2 && pcLow <= pcHigh)
+            ;
+        else if(strcmp(argv[i], "-render") == 0 && i+1 < argc)
+            renderName = argv[++i];
+        else if(strcmp(argv[i], "-stack") == 0 && i+1 < argc && (stackHeight = atoi(argv[++i])) >= 4 && stackHeight <= MAX_STACK_LIMIT)
+            ;
+        else{
+            printf("Bad option %s\nExiting Program ...\n", argv[i]);
+            return -1;
+        }
+    }
+    if(argc < 2){
+        printf("Usage: vm program [-fast [-engine switch|decoded|jit]] [-trace file [-ring N] [-sample N] [-pc lo-hi]] [-render file] [-bench] [-diff] [-stack N]\n");
+        return -1;
+    }
+    if(reserveStack())
+        return -1;
+
+    stack[1] = 0;
+    stack[2] = 0;
+    stack[3] = 0;
+    display[0] = bp;
+
+    /***
+    ///open files
+    fp = fopen("test.txt", "r");
+    ///ofp = fopen("testout.txt", "w");
+    if(fp==NULL) //|| ofp==NULL)
+        printf("error opening file\n");
+    ***/
+
+    fp = fopen(argv[1], "r");       // open the input file
+    ///ofp = fopen("trace.txt", "w");  // open the output file
+    if(fp==NULL) {
+        printf("Error opening input file %s\nExiting Program ...\n", argv[1]);
+        return -1;
+    }
+    ///if (ofp == NULL) {
+    ///    printf("Error opening output file\nExiting Program ...\n");
+    ///    return -1;
+
+    ///a PM0B file is mapped and run where it is, anything else is text
+    char magic[4];
+    if(fread(magic, 1, 4, fp) == 4 && memcmp(magic, PM0B_MAGIC, 4) == 0){
+        if(loadBinary(argv[1]))
+            return -1;
+    }
+    else{
+        ///read fp into code[], doubling it whenever it fills up
+        rewind(fp);
+        instr in;
+        while(fscanf(fp, "%d %d %d", &in.op, &in.l, &in.m) == 3){
+            if(codeSize == codeCap){
+                codeCap = codeCap ? codeCap*2 : 512;
+                code = realloc(code, codeCap * sizeof(instr));
+                if(code == NULL){
+                    printf("Out of memory loading %s\nExiting Program ...\n", argv[1]);
+                    return -1;
+                }
+            }
+            code[codeSize++] = in;
+        }
+    }
+    if(codeSize == 0){     // nothing to fetch, and fetchCycle() doesn't check before it does
+        printf("%s has no instructions to run\nExiting Program ...\n", argv[1]);
+        return -1;
+    }
+    if(renderName != NULL){
+        if(renderTrace(renderName))
+            return -1;
+    }
+    else if(traceName != NULL){
+        if(pcHigh < 0)
+            pcHigh = codeSize-1;
+        if(traceOpen(&trace, traceName, ring, sample, pcLow, pcHigh))
+            return -1;
+        do{
+            i = pc;
+            fetchCycle();
+            executeCycle();
+            traceStep(&trace, i);
+        } while(!halt());
+        if(traceClose(&trace))
+            return -1;
+    }
+    else if(bench)
+        benchmark();
+    else if(diff){
+        if(differ())
+            return 1;
+    }
+    else if(fast)
+        runEngine(engine);
+    else{
+        ///print pl/0 code
+        printf("PL/0 code:\n\n");
+        printCode();
+
+        ///print execution
+        printHeading();
+        do{
+            fetchCycle();
+            printStep(pc-1, ir);
+            executeCycle();
+            printStateE();
+            //write_Stack(bp, sp);
+            printStack();
+        } while(!halt());
+    }
+
+    fclose(fp);
+    ///fclose(ofp);
+    if(mapped != NULL){
+#ifndef _WIN32
+        munmap(mapped, mappedSize);
+#else
+        free(mapped);
+#endif
+    }
+    else
+        free(code);
+    return 0;
+}
+
+/// map a PM0B file and point code[] at the instructions in it, see pm0b.h
+int loadBinary(const char *fileName)
+{
+    pm0bHeader header;
+#ifndef _WIN32
+    struct stat info;
+    int fd = open(fileName, O_RDONLY);
+    if(fd >= 0 && fstat(fd, &info) == 0 && info.st_size >= (off_t)sizeof(header)){
+        mappedSize = info.st_size;
+        mapped = mmap(NULL, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED)
+            mapped = NULL;
+    }
+    if(fd >= 0)
+        close(fd);
+#else
+    FILE *in = fopen(fileName, "rb");      // no mmap here, read it all in one go instead
+    if(in != NULL && fseek(in, 0, SEEK_END) == 0 && ftell(in) >= (long)sizeof(header)){
+        mappedSize = ftell(in);
+        rewind(in);
+        mapped = malloc(mappedSize);
+        if(mapped != NULL && fread(mapped, 1, mappedSize, in) != mappedSize){
+            free(mapped);
+            mapped = NULL;
+        }
+    }
+    if(in != NULL)
+        fclose(in);
+#endif
+    if(mapped == NULL){
+        printf("Error loading %s\nExiting Program ...\n", fileName);
+        return 1;
+    }
+
+    memcpy(&header, mapped, sizeof(header));
+    if(memcmp(header.magic, PM0B_MAGIC, 4) != 0 || header.version != PM0B_VERSION || header.count < 0
+       || (mappedSize - sizeof(header)) / sizeof(instr) < (size_t)header.count
+       || header.entry < 0 || header.entry >= header.count){
+        printf("%s is not a PM0B file this VM can run\nExiting Program ...\n", fileName);
+        return 1;
+    }
+    code = (instr *)(mapped + sizeof(header));   // 32 bytes in, the instructions are aligned
+    codeSize = header.count;
+    pc = entry = header.entry;
+    return 0;
+}
+
+/// start a binary trace of the run to fileName, see pm0trace.h
+int traceOpen(tracer *t, const char *fileName, int ring, int sample, int pcLow, int pcHigh)
+{
+    static int registered = 0;
+
+    memset(t, 0, sizeof(tracer));
+    t->ring = ring > 0;
+    t->size = ring > 0 ? ring : TRACE_BUFFER;
+    t->buffer = malloc(t->size * sizeof(pm0tRecord));
+    t->out = fopen(fileName, "wb");
+    if(t->buffer == NULL || t->out == NULL){
+        printf("Error opening trace file %s\nExiting Program ...\n", fileName);
+        free(t->buffer);
+        if(t->out != NULL)
+            fclose(t->out);
+        return 1;
+    }
+    setvbuf(t->out, NULL, _IONBF, 0);      // the records are buffered already, and this way nothing is left in stdio
+    t->fd = fileno(t->out);
+    memcpy(t->header.magic, PM0T_MAGIC, 4);
+    t->header.version = PM0T_VERSION;
+    t->header.sample = sample;
+    t->header.pcLow = pcLow;
+    t->header.pcHigh = pcHigh;
+    fwrite(&t->header, sizeof(pm0tHeader), 1, t->out);     // written again once we know how it went
+    if(!registered){
+        atexit(traceAtExit);
+        signal(SIGFPE, traceOnSignal);      // dividing by 0, or running off the stack, is when the trace is wanted most
+#ifdef _WIN32
+        signal(SIGSEGV, traceOnSignal);     // anywhere else stackOnSignal() sees to that
+#endif
+    }
+    registered = 1;
+    openTrace = t;
+    return 0;
+}
+
+/// record the instruction at addr that just ran, if the trace keeps this step
+void traceStep(tracer *t, int addr)
+{
+    long long step = steps++;
+    pm0tRecord *r;
+
+    if(step % t->header.sample != 0 || addr < t->header.pcLow || addr > t->header.pcHigh)
+        return;
+    if(!t->ring && t->kept == t->written + t->size){     // buffer's full, out it goes
+        fwrite(t->buffer, sizeof(pm0tRecord), t->size, t->out);
+        t->written += t->size;
+    }
+    r = &t->buffer[t->kept % t->size];
+    r->step = step;
+    r->addr = addr;
+    r->op = ir.op;
+    r->l = ir.l;
+    r->m = ir.m;
+    r->pc = pc;
+    r->bp = bp;
+    r->sp = sp;
+    r->top = sp >= 0 && sp <= stackHeight ? stack[sp] : 0;
+    r->reserved[0] = r->reserved[1] = 0;
+    t->kept++;
+}
+
+/// fill in the header for how the run went. Returns how many records are still to write, from buffer[start] on and
+/// carrying on from buffer[0] if that reaches the end
+long long traceFinish(tracer *t, long long *start)
+{
+    long long count = t->kept - t->written;
+
+    *start = 0;
+    if(t->ring && t->kept > t->size){       // wrapped, the oldest record left is the one the next would have gone over
+        *start = t->kept % t->size;
+        count = t->size;
+        t->header.flags |= PM0T_WRAPPED;
+    }
+    t->header.steps = steps;
+    t->header.count = t->written + count;
+    if(t->header.sample == 1 && t->header.pcLow <= 0 && t->header.pcHigh >= codeSize-1 && !(t->header.flags & PM0T_WRAPPED))
+        t->header.flags |= PM0T_COMPLETE;
+    return count;
+}
+
+/// write out what's left of the trace and the header that says what's in it
+int traceClose(tracer *t)
+{
+    long long start, count = traceFinish(t, &start);
+    int failed;
+
+    fwrite(t->buffer + start, sizeof(pm0tRecord), count - start, t->out);
+    fwrite(t->buffer, sizeof(pm0tRecord), start, t->out);
+    rewind(t->out);
+    fwrite(&t->header, sizeof(pm0tHeader), 1, t->out);
+    failed = ferror(t->out) != 0;
+    failed |= fclose(t->out) != 0;
+    free(t->buffer);
+    openTrace = NULL;
+    if(failed)
+        printf("Error writing the trace file\n");
+    return failed;
+}
+
+void traceAtExit()
+{
+    if(openTrace != NULL)
+        traceClose(openTrace);
+}
+
+/// traceClose() for a signal handler, with only write() and lseek(). The buffer and file are left for the exit
+void traceOnCrash()
+{
+    tracer *t = openTrace;
+    long long start, count;
+
+    if(t == NULL)
+        return;
+    openTrace = NULL;
+    count = traceFinish(t, &start);
+#ifndef _WIN32
+    if(write(t->fd, t->buffer + start, (count - start) * sizeof(pm0tRecord)) < 0
+       || write(t->fd, t->buffer, start * sizeof(pm0tRecord)) < 0
+       || lseek(t->fd, 0, SEEK_SET) < 0
+       || write(t->fd, &t->header, sizeof(pm0tHeader)) < 0)
+        return;                             // nothing more to be done about it from here
+#else
+    (void)count;
+    traceClose(t);                          // no write() here, so it's stdio and best effort
+#endif
+}
+
+/// the program crashed the VM, keep what the trace has and crash the same way
+void traceOnSignal(int sig)
+{
+    traceOnCrash();
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+/// print the trace in fileName, taken running the program we loaded, the way the run would have printed it
+int renderTrace(const char *fileName)
+{
+    FILE *trace = fopen(fileName, "rb");
+    pm0tHeader header;
+    pm0tRecord r;
+    instr in;
+    long long next = 0, i;
+
+    if(trace == NULL || fread(&header, sizeof(header), 1, trace) != 1
+       || memcmp(header.magic, PM0T_MAGIC, 4) != 0 || header.version != PM0T_VERSION){
+        printf("%s is not a trace this VM can render\nExiting Program ...\n", fileName);
+        if(trace != NULL)
+            fclose(trace);
+        return 1;
+    }
+    printf("PL/0 code:\n\n");
+    printCode();
+
+    if(header.flags & PM0T_COMPLETE){
+        ///every step is there, so run the program again, reading what it read from the trace, and print the lot
+        replaying = 1;
+        printHeading();
+        do{
+            if(steps < header.count){       // past the last record is the step the traced run died on
+                if(fread(&r, sizeof(r), 1, trace) != 1 || r.step != steps || r.addr != pc){
+                    printf("\n%s doesn't go with this program from step %lld on\nExiting Program ...\n", fileName, steps);
+                    fclose(trace);
+                    return 1;
+                }
+                replayInput = r.top;
+            }
+            steps++;
+            fetchCycle();
+            printStep(pc-1, ir);
+            executeCycle();
+            printStateE();
+            printStack();
+        } while(!halt());
+    }
+    else{
+        ///only some steps are there, and all a record has of the stack is its top
+        printf("Execution, one step in %d at %d to %d%s:\n", header.sample, header.pcLow, header.pcHigh,
+               header.flags & PM0T_WRAPPED ? ", the last ones only" : "");
+        printf("                      pc   bp   sp   stack\n");
+        for(i=0; i<header.count && fread(&r, sizeof(r), 1, trace) == 1; i++){
+            if(r.step != next)
+                printf("     ... %lld steps\n", r.step - next);
+            in.op = r.op;
+            in.l = r.l;
+            in.m = r.m;
+            printStep(r.addr, in);
+            printf("%6d%5d%5d   ", r.pc, r.bp, r.sp);
+            if(r.sp > 0)
+                printf("... %d ", r.top);
+            printf("\n");
+            next = r.step + 1;
+        }
+        if(next < header.steps)
+            printf("     ... %lld steps\n", header.steps - next);
+    }
+    fclose(trace);
+    return 0;
+}
+
+void write_Stack(int bp, int sp)
+{
+    // TO DO - Write the contents of the stack to output_file
+    int i;
+    if (bp > 1) {
+        write_Stack(stack[bp+2], bp-1);
+        if (bp<sp)
+            printf("| ");
+        for (i = bp; i <= sp; i++) {
+            printf("%d ", stack[i]);
+        }
+        printf("\n");
+    }
+    else {
+        for (i=bp; i<=sp; i++)
+        {
+            printf("%d ", stack[i]);
+        }
+    }
+    printf("\n");
+}
+
+void printCode()
+{
+    int i;
+    for(i=0; i<codeSize; i++){
+        switch(code[i].op){
+            /// LIT __  M
+            case 1:
+                printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            /// OPR
+            case 2:
+                if(code[i].m == 0)
+                    printf("%3d  %s\n", i, opcodesOPR[code[i].m]);
+                else
+                    printf("%3d  %s%5d%5d\n", i, opcodesOPR[code[i].m], code[i].l, code[i].m);
+                break;
+                //switch(ir.m){
+                /// RET __ __
+                //case 0:
+                    //printf("%3d  %s\n", i, opcodesOPR[code[i].m]);
+                ///
+                //}
+            /// LOD L M
+            case 3:
+                printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);
+                break;
+            /// STO L M
+            case 4:
+                printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);
+                break;
+            /// CAL L M
+            case 5:
+                printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);
+                break;
+            /// INC __ M
+            case 6:
+                printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            /// JMP __ M
+            case 7:
+                printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            ///??????????? JPC __ M ?????????
+            case 8:
+                printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            /// J<rel> __ M, JNZ __ M
+            case 10: case 11: case 12: case 13: case 14: case 15: case 24:
+                printf("%3d  %s %9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            /// L<opr> L M
+            case 16: case 17: case 18: case 19:
+                printf("%3d  %s%4d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);
+                break;
+            /// I<opr> __ M
+            case 20: case 21: case 22: case 23:
+                printf("%3d  %s%9d\n", i, opcodes[code[i].op], code[i].m);
+                break;
+            /// SIO
+            case 9:
+                if(code[i].m == 2)
+                    printf("%3d  %s\n", i, opcodesSIO[code[i].m]);
+                else
+                    printf("%3d  %s %9d\n", i, opcodesSIO[code[i].m], code[i].m);
+                break;
+            default:
+                ;
+        }
+    }
+    printf("\n");
+    /*
+    if (code[i].op == 2)
+        printf("%3d  %s%5d%5d\n", i, opcodesOPR[code[i].m], code[i].l, code[i].m);
+    if (code[i].op == 9)
+        printf("%3d  %s\n", i, opcodesSIO[code[i].m]);
+    else
+        printf("%3d  %s%5d%5d\n", i, opcodes[code[i].op], code[i].l, code[i].m);
+    }
+    printf("\n");*/
+}
+
+void printHeading()
+{
+    printf("Execution:\n");
+    printf("                      pc   bp   sp   stack\n");
+    printf("%24d%5d%5d  \n", pc, bp, sp);
+}
+
+/// print state of machine after execute cycle
+void printStateE()
+{
+    if(sp==0 || bp==1)
+        printf("%6d%5d%5d", pc, bp, sp);
+    else
+        printf("%6d%5d%5d", pc, bp, sp);
+}
+
+void printStack()
+{
+    int i, bp_copy=bp;
+    printf("   ");
+    /*if(sp==0){
+    } else if(bp_copy==1){
+        for (i=1; i<=sp; i++)
+            printf("%d ", stack[i]);
+    }
+    for (i=1; i<=bp_copy; i++)
+        printf("%d ", stack[i]);
+    if(bp_copy>1){
+        if(bp_copy<sp){
+            printf(" | ");
+            for (i=bp_copy; i<=sp; i++)
+                printf("%d ", stack[i]);
+        }
+    }
+//      if(bp==1)
+//         break;*/
+    if(bp_copy==1 && sp!=0){
+        for(i=1; i<=sp; i++)
+            printf("%d ", stack[i]);
+    }
+    else if(bp_copy>1){
+        for(i=1; i<bp_copy; i++)
+            printf("%d ", stack[i]);
+        if(bp_copy<sp)
+            printf("| ");
+        for(i=bp_copy; i<=sp; i++)
+            printf("%d ", stack[i]);
+    }
+    printf("\n");
+}
+
+/// print the instruction at addr the way the trace shows it, before the state after it ran
+void printStep(int addr, instr in)
+{
+    switch(in.op){
+        case 1: case 6: case 7: case 8:
+        case 10: case 11: case 12: case 13: case 14: case 15: case 24:
+            printf("%3d  %s %9d", addr, opcodes[in.op], in.m);
+            break;
+        case 2:
+            printf("%3d  %s  \t  ", addr, in.m >= 0 && in.m <= 13 ? opcodesOPR[in.m] : opcodes[in.op]);
+            break;
+        case 3: case 4: case 5:
+            printf("%3d  %s%5d%5d", addr, opcodes[in.op], in.l, in.m);
+            break;
+        case 16: case 17: case 18: case 19:
+            printf("%3d  %s%4d%5d", addr, opcodes[in.op], in.l, in.m);
+            break;
+        case 20: case 21: case 22: case 23:
+            printf("%3d  %s%9d", addr, opcodes[in.op], in.m);
+            break;
+        case 9:
+            if(in.m == 0 || in.m == 1)
+                printf("%3d  %s %9d", addr, opcodesSIO[in.m], in.m);
+            else if(in.m == 2)
+                printf("%3d  %s \t  ", addr, opcodesSIO[in.m]);
+            break;
+        default:
+            ;
+    }
+}
+
+void printStackAR()
+{
+    int i = 1;
+    printf("  ");
+    for (i=2; i<=sp; i++)
+        printf("%2d", stack[i]);
+    printf(" |");
+}
+
+void fetchCycle()
+{
+    ir = code[pc];
+    pc++;
+    //printf("%d fetched\n", ir.op);
+}
+
+void executeCycle()
+{
+    switch(ir.op){
+        // 01 LIT 0 M  push m onto stack
+        case 1:
+            //printf("executing LIT\n");
+            sp = sp + 1;
+            stack[sp] = ir.m;
+            break;
+        // 02 OPR 0 M
+        case 2:
+            //printf("executing OPR\n");
+            //printf("%3d  %s%5d%5d\n", pc-1, opcodesOPR[ir.m], ir.l, ir.m);
+            switch(ir.m){
+                /// RET
+                case 0:
+                    pc = returnFromProcedure();
+                    break;
+                /// NEG
+                case 1:
+                    stack[sp] = -stack[sp];
+                    break;
+                ///ADD
+                case 2:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] + stack[sp+1];
+                    break;
+                /// SUB
+                case 3:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] - stack[sp+1];
+                    break;
+                /// MUL
+                case 4:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] * stack[sp+1];
+                    break;
+                /// DIV
+                case 5:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] / stack[sp+1];
+                    break;
+                /// ODD
+                case 6:
+                    stack[sp] = stack[sp] & 1;
+                    break;
+                /// MOD
+                case 7:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] % stack[sp+1];
+                    break;
+                /// EQL
+                case 8:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] == stack[sp+1];
+                    break;
+                /// NEQ
+                case 9:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] != stack[sp+1];
+                    break;
+                /// LSS
+                case 10:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] < stack[sp+1];
+                    break;
+                /// LEQ
+                case 11:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] <= stack[sp+1];
+                    break;
+                /// GTR
+                case 12:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] > stack[sp+1];
+                    break;
+                /// GEQ
+                case 13:
+                    sp = sp-1;
+                    stack[sp] = stack[sp] >= stack[sp+1];
+                    break;
+                default:
+                    printf("error executing OPR\n");
+            }
+            break;
+        // 03 LOD L M  push stack value of offset M in frame L levels down
+        case 3:
+            //printf("executing LOD\n");
+            sp = sp + 1;
+            stack[sp] = stack[frame(ir.l) + ir.m];
+            break;
+        // 04 STO L M  pop stack, insert val at offset M in frame L levels down
+        case 4:
+            //printf("executing STO\n");
+            stack[frame(ir.l) + ir.m] = stack[sp];
+            sp--;
+            //if(sp>0)
+                //sp--;
+            break;
+        // 05 CAL L M Call procedure at M
+        case 5:
+            //printf("executing CAL\n");
+            //printStackAR();
+            callProcedure(ir.l, ir.m, pc);
+            pc = ir.m;
+            //printStack();
+            break;
+        // 06 INC 0 M  allocate m locals on stack
+        case 6:
+            //printf("executing INC\n");
+            /*if(sp == 0){        // What is this for?
+                sp = ir.m + 1;      // We add M to 0, and then add 1
+                sp--;               // only to subtract 1 after? This makes no sense.
+            }
+            else */
+            if((long long)sp + ir.m > stackHeight)
+                stackOverflow(pc-1);
+            sp = sp + ir.m;     // Just add sp to M and be done with it. Both if branches ended up doing exactly the same thing.
+            break;
+        // 07 JMP 0 M  jump to M
+        case 7:
+            //printf("executing JMP\n");
+            //printf("%10d", ir.m);
+            pc = ir.m;      //NOOOO! Not sp+ This is not opr 6, it's 7... This is Jump. You jump to M, not to M+sp No wonder we seg faulted!
+            break;
+        // 08 JPC   pop stack, jump to m
+        case 8:
+            //printf("executing JPC\n");
+            if(stack[sp] == 0)
+                pc = ir.m;
+            sp = sp-1;
+            break;
+        // 10-15 JEQ JNE JLT JLE JGT JGE  pop two, jump to m if the comparison holds
+        case 10: case 11: case 12: case 13: case 14: case 15:
+            sp = sp-2;
+            if(compare(ir.op - 10, stack[sp+1], stack[sp+2]))
+                pc = ir.m;
+            break;
+        // 24 JNZ  pop stack, jump to m if it isn't 0
+        case 24:
+            if(stack[sp] != 0)
+                pc = ir.m;
+            sp = sp-1;
+            break;
+        // 16-19 LADD LSUB LMUL LDIV L M  apply the operator to the top of the stack and the value at offset M in frame L levels down
+        case 16: case 17: case 18: case 19:
+            stack[sp] = arith(ir.op - 16, stack[sp], stack[frame(ir.l) + ir.m]);
+            break;
+        // 20-23 IADD ISUB IMUL IDIV 0 M  apply the operator to the top of the stack and m
+        case 20: case 21: case 22: case 23:
+            stack[sp] = arith(ir.op - 20, stack[sp], ir.m);
+            break;
+        // 09 SIO
+        case 9:
+            //printf("executing SIO\n");
+            //printf("executing SIO\n");
+            //printf("%3d  %s%5d%5d\n", pc-1, opcodesSIO[ir.m], ir.l, ir.m);
+            switch(ir.m){
+                // pop stack
+                case 0:
+                    writeNumber(stack[sp]);
+                    sp = sp-1;
+                    break;
+                // push user input
+                case 1:
+                    sp = sp+1;
+                    readNumber(&(stack[sp]));
+                    break;
+                // halt
+                case 2:
+                    //printf("halting...\n");
+                    /*printf("%3d  %s\n", pc-1, opcodesSIO[ir.m]);
+                    */
+                    break;
+                default:
+                    printf("SIO error\n");
+            }
+            break;
+        // default
+        default:
+            //printf("exec error\n");
+            ;
+    }
+    //printState(ir);
+}
+
+/// the pre-decoded engine: code[] is turned into a stream of handlers, one for every instruction, with OPR and SIO split
+/// into a handler for each of their M's, and LOD/STO with L 0 given their own. Built with gcc each handler jumps straight
+/// to the next one's label (computed goto), anything else gets the same handlers as cases of one switch
+void runDecoded()
+{
+#ifdef VM_THREADED
+#define X(name) &&L_##name,
+    static const void *labels[] = {VM_HANDLERS};
+#undef X
+#define HANDLER(name) L_##name:
+#define NEXT in = next++; goto *in->handler
+#else
+#define HANDLER(name) case T_##name:
+#define NEXT continue
+#endif
+#define FRAME(l) ((l) >= 0 && (l) <= curLevel ? display[curLevel - (l)] : base((l), b))
+    decoded *prog = malloc((codeSize+1) * sizeof(decoded)), *in, *next;
+    int s = sp, b = bp, i, f;
+
+    if(prog == NULL){           // no room for it, the plain engine doesn't need any
+        do{
+            fetchCycle();
+            executeCycle();
+        } while(!halt());
+        return;
+    }
+    for(i=0; i<=codeSize; i++){
+        f = i < codeSize ? decodeKind(code[i]) : T_END;    // one past the end stops it, like running off the end does
+#ifdef VM_THREADED
+        prog[i].handler = labels[f];
+#else
+        prog[i].handler = f;
+#endif
+        prog[i].l = i < codeSize ? code[i].l : 0;
+        prog[i].m = i < codeSize ? code[i].m : 0;
+        if(f == T_CAL || f == T_JMP || f == T_JPC || f == T_JNZ || (f >= T_JEQ && f <= T_JGE))
+            prog[i].m = (unsigned)prog[i].m < (unsigned)codeSize ? prog[i].m : codeSize;   // jumping out of the program stops it too
+    }
+    next = prog + ((unsigned)pc < (unsigned)codeSize ? pc : codeSize);
+
+#ifdef VM_THREADED
+    NEXT;
+#else
+    for(;;){
+        in = next++;
+        switch(in->handler){
+#endif
+    HANDLER(LIT)    stack[++s] = in->m; NEXT;
+    HANDLER(RET)    s = b-1;
+                    i = stack[s+4];
+                    b = stack[s+3];
+                    if(callDepth > 0){
+                        callDepth--;
+                        display[curLevel] = calls[callDepth].saved;
+                        curLevel = calls[callDepth].level;
+                    }
+                    else
+                        display[curLevel] = b;
+                    next = prog + ((unsigned)i < (unsigned)codeSize ? i : codeSize);
+                    NEXT;
+    HANDLER(NEG)    stack[s] = -stack[s]; NEXT;
+    HANDLER(ADD)    s--; stack[s] = stack[s] + stack[s+1]; NEXT;
+    HANDLER(SUB)    s--; stack[s] = stack[s] - stack[s+1]; NEXT;
+    HANDLER(MUL)    s--; stack[s] = stack[s] * stack[s+1]; NEXT;
+    HANDLER(DIV)    s--; stack[s] = stack[s] / stack[s+1]; NEXT;
+    HANDLER(ODD)    stack[s] = stack[s] & 1; NEXT;
+    HANDLER(MOD)    s--; stack[s] = stack[s] % stack[s+1]; NEXT;
+    HANDLER(EQL)    s--; stack[s] = stack[s] == stack[s+1]; NEXT;
+    HANDLER(NEQ)    s--; stack[s] = stack[s] != stack[s+1]; NEXT;
+    HANDLER(LSS)    s--; stack[s] = stack[s] < stack[s+1]; NEXT;
+    HANDLER(LEQ)    s--; stack[s] = stack[s] <= stack[s+1]; NEXT;
+    HANDLER(GTR)    s--; stack[s] = stack[s] > stack[s+1]; NEXT;
+    HANDLER(GEQ)    s--; stack[s] = stack[s] >= stack[s+1]; NEXT;
+    HANDLER(BADOPR) printf("error executing OPR\n"); NEXT;
+    HANDLER(LOD0)   stack[s+1] = stack[display[curLevel] + in->m]; s++; NEXT;
+    HANDLER(LOD)    stack[s+1] = stack[FRAME(in->l) + in->m]; s++; NEXT;
+    HANDLER(STO0)   stack[display[curLevel] + in->m] = stack[s]; s--; NEXT;
+    HANDLER(STO)    stack[FRAME(in->l) + in->m] = stack[s]; s--; NEXT;
+    HANDLER(CAL)    if(in->l < 0 || in->l > curLevel+1 || callDepth == maxCallDepth){
+                        printf("\nCAL %d %d can't be made from lex level %d at call depth %d\nExiting Program ...\n", in->l, code[in-prog].m, curLevel, callDepth);
+                        exit(1);
+                    }
+                    if(s+4 > stackHeight)
+                        stackOverflow(in - prog);
+                    f = FRAME(in->l);
+                    stack[s+1] = 0;
+                    stack[s+2] = f;
+                    stack[s+3] = b;
+                    stack[s+4] = next - prog;
+                    b = s+1;
+                    next = prog + in->m;
+                    calls[callDepth].level = curLevel;
+                    curLevel = curLevel + 1 - in->l;
+                    calls[callDepth].saved = display[curLevel];
+                    callDepth++;
+                    display[curLevel] = b;
+                    NEXT;
+    HANDLER(INC)    if((long long)s + in->m > stackHeight)
+                        stackOverflow(in - prog);
+                    s += in->m;
+                    NEXT;
+    HANDLER(JMP)    next = prog + in->m; NEXT;
+    HANDLER(JPC)    if(stack[s--] == 0) next = prog + in->m; NEXT;
+    HANDLER(JNZ)    if(stack[s--] != 0) next = prog + in->m; NEXT;
+    HANDLER(JEQ)    s -= 2; if(stack[s+1] == stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(JNE)    s -= 2; if(stack[s+1] != stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(JLT)    s -= 2; if(stack[s+1] < stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(JLE)    s -= 2; if(stack[s+1] <= stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(JGT)    s -= 2; if(stack[s+1] > stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(JGE)    s -= 2; if(stack[s+1] >= stack[s+2]) next = prog + in->m; NEXT;
+    HANDLER(LADD)   stack[s] = stack[s] + stack[FRAME(in->l) + in->m]; NEXT;
+    HANDLER(LSUB)   stack[s] = stack[s] - stack[FRAME(in->l) + in->m]; NEXT;
+    HANDLER(LMUL)   stack[s] = stack[s] * stack[FRAME(in->l) + in->m]; NEXT;
+    HANDLER(LDIV)   stack[s] = stack[s] / stack[FRAME(in->l) + in->m]; NEXT;
+    HANDLER(IADD)   stack[s] = stack[s] + in->m; NEXT;
+    HANDLER(ISUB)   stack[s] = stack[s] - in->m; NEXT;
+    HANDLER(IMUL)   stack[s] = stack[s] * in->m; NEXT;
+    HANDLER(IDIV)   stack[s] = stack[s] / in->m; NEXT;
+    HANDLER(OUT)    writeNumber(stack[s--]); NEXT;
+    HANDLER(INP)    readNumber(&stack[++s]); NEXT;
+    HANDLER(BADSIO) printf("SIO error\n"); NEXT;
+    HANDLER(NOP)    NEXT;
+    HANDLER(HLT)    goto done;
+    HANDLER(END)    goto done;
+#ifndef VM_THREADED
+        }
+    }
+#endif
+done:
+    sp = s;
+    bp = b;
+    pc = next - prog;
+    free(prog);
+#undef HANDLER
+#undef NEXT
+#undef FRAME
+}
+
+/// which of the pre-decoded engine's handlers runs in
+int decodeKind(instr in)
+{
+    switch(in.op){
+        case 1: return T_LIT;
+        case 2: return in.m >= 0 && in.m <= 13 ? T_RET + in.m : T_BADOPR;
+        case 3: return in.l == 0 ? T_LOD0 : T_LOD;
+        case 4: return in.l == 0 ? T_STO0 : T_STO;
+        case 5: return T_CAL;
+        case 6: return T_INC;
+        case 7: return T_JMP;
+        case 8: return T_JPC;
+        case 9: return in.m >= 0 && in.m <= 2 ? T_OUT + in.m : T_BADSIO;
+        case 10: case 11: case 12: case 13: case 14: case 15: return T_JEQ + in.op - 10;
+        case 16: case 17: case 18: case 19: return T_LADD + in.op - 16;
+        case 20: case 21: case 22: case 23: return T_IADD + in.op - 20;
+        case 24: return T_JNZ;
+        default: return T_NOP;
+    }
+}
+
+/// CAL L M, with ret to come back to: the activation record goes on top of the stack and the display follows the callee
+void callProcedure(int l, int m, int ret)
+{
+    if(l < 0 || l > curLevel+1 || callDepth == maxCallDepth){
+        printf("\nCAL %d %d can't be made from lex level %d at call depth %d\nExiting Program ...\n", l, m, curLevel, callDepth);
+        exit(1);
+    }
+    if(sp+4 > stackHeight)
+        stackOverflow(ret-1);
+    stack[sp+1] = 0;       // return value
+    stack[sp+2] = frame(l);             //static link
+    stack[sp+3] = bp;       //dynamic link
+    stack[sp+4] = ret;      // return address
+    bp = sp+1;
+    calls[callDepth].level = curLevel;      // the callee is at lex level curLevel+1-L
+    curLevel = curLevel + 1 - l;
+    calls[callDepth].saved = display[curLevel];
+    callDepth++;
+    display[curLevel] = bp;
+}
+
+/// RET, returns where to go back to
+int returnFromProcedure()
+{
+    int ret;
+
+    sp = bp-1;
+    ret = stack[sp+4]; //4
+    bp = stack[sp+3]; //3
+    if(callDepth > 0){      // put back the caller's display
+        callDepth--;
+        display[curLevel] = calls[callDepth].saved;
+        curLevel = calls[callDepth].level;
+    }
+    else                    // returning from the main block, there's no caller to go back to
+        display[curLevel] = bp;
+    return ret;
+}
+
+/// what OUT does with the number it pops
+void writeNumber(int n)
+{
+    if(outputs != NULL){        // -diff, keep it to compare with the other engines
+        if(outputCount == outputCap){
+            outputCap = outputCap ? outputCap*2 : 64;
+            outputs = realloc(outputs, outputCap * sizeof(int));
+            if(outputs == NULL){
+                printf("Out of memory keeping the output\nExiting Program ...\n");
+                exit(1);
+            }
+        }
+        outputs[outputCount++] = n;
+    }
+    else if(!quiet)
+        printf("popped stack val: %d\n", n);
+}
+
+/// what INP pushes
+void readNumber(int *to)
+{
+    if(replaying)               // rendering a trace, take what the traced run read
+        *to = replayInput;
+    else if(inputs != NULL){    // -bench, every run reads the same numbers
+        if(inputNext < inputCount)
+            *to = inputs[inputNext++];
+    }
+    else
+        scanf("%d", to);
+}
+
+/// back to how the program starts, for running it again
+void resetVM()
+{
+    clearStack();
+    bp = 1;
+    sp = 0;
+    pc = entry;
+    display[0] = bp;
+    curLevel = 0;
+    callDepth = 0;
+    inputNext = 0;
+}
+
+/// run the program from pc on engine e
+void runEngine(int e)
+{
+    if(e == ENGINE_DECODED)
+        runDecoded();
+#ifdef VM_JIT
+    else if(e == ENGINE_JIT && runJit() == 0)
+        ;
+#endif
+    else{                       // the switch, and the JIT's fallback if it couldn't compile the program
+        do{
+            fetchCycle();
+            executeCycle();
+        } while(!halt());
+    }
+}
+
+int engineNamed(const char *name)
+{
+    int e;
+    for(e=0; e<ENGINE_COUNT; e++){
+        if(strcmp(name, engineNames[e]) == 0)
+            return e;
+    }
+    return -1;
+}
+
+/// read all of stdin for INP, so the program can be run more than once on the same numbers
+void readInputs()
+{
+    int capacity = 0, i;
+
+    for(i=0; i<codeSize && !(code[i].op == 9 && code[i].m == 1); i++)
+        ;
+    while(1){
+        if(inputCount == capacity){
+            capacity = capacity ? capacity*2 : 64;
+            inputs = realloc(inputs, capacity * sizeof(int));
+            if(inputs == NULL){
+                printf("Out of memory reading the input\nExiting Program ...\n");
+                exit(1);
+            }
+        }
+        if(i == codeSize || scanf("%d", &inputs[inputCount]) != 1)     // no INP, don't wait for input nobody reads
+            break;
+        inputCount++;
+    }
+}
+
+/// run the program with each engine and print how many instructions a second they get through
+void benchmark()
+{
+    int e, run;
+    clock_t start;
+    double best, took;
+
+    readInputs();
+    quiet = 1;
+
+    resetVM();                  // count the steps first, so none of the timed runs pays for counting them
+    do{
+        fetchCycle();
+        executeCycle();
+        steps++;
+    } while(!halt());
+    printf("%lld instructions a run, best of %d runs\n", steps, BENCH_RUNS);
+
+    for(e=0; e<ENGINE_COUNT; e++){
+        best = -1;
+        for(run=0; run<BENCH_RUNS; run++){
+            resetVM();
+            start = clock();
+            runEngine(e);
+            took = (double)(clock() - start) / CLOCKS_PER_SEC;
+            if(best < 0 || took < best)
+                best = took;
+        }
+        printf("%-10s%10.1f ms", engineNames[e], best * 1000);
+        if(best > 0)
+            printf("%10.1f million instructions/s", steps / best / 1e6);
+        printf("\n");
+    }
+}
+
+/// run the program on every engine with the same input, and check they all write the same numbers and leave the
+/// registers and the stack just as the switch does. Returns 1 if any of them don't
+int differ()
+{
+    int *first = malloc((size_t)(stackHeight+1) * sizeof(int));
+    int *firstOutputs = NULL, firstCount = 0, firstSp = 0, firstBp = 0, e, i, differs = 0;
+
+    if(first == NULL){
+        printf("Out of memory keeping the stack\nExiting Program ...\n");
+        exit(1);
+    }
+    readInputs();
+    for(e=0; e<ENGINE_COUNT; e++){
+        resetVM();
+        outputCount = 0;
+        outputCap = 64;
+        outputs = malloc(outputCap * sizeof(int));
+        if(outputs == NULL){
+            printf("Out of memory keeping the output\nExiting Program ...\n");
+            exit(1);
+        }
+#ifdef VM_JIT
+        if(e == ENGINE_JIT && runJit() != 0){
+            printf("%-10scouldn't compile the program\n", engineNames[e]);
+            differs = 1;
+            free(outputs);
+            continue;
+        }
+#endif
+        if(e != ENGINE_JIT)
+            runEngine(e);
+
+        if(e == ENGINE_SWITCH){
+            firstOutputs = outputs;
+            firstCount = outputCount;
+            firstSp = sp;
+            firstBp = bp;
+            memcpy(first, stack, (size_t)(stackHeight+1) * sizeof(int));
+            printf("%-10swrote %d numbers, finished with sp %d bp %d\n", engineNames[e], outputCount, sp, bp);
+            continue;
+        }
+        printf("%-10s", engineNames[e]);
+        for(i=0; i<outputCount && i<firstCount && outputs[i] == firstOutputs[i]; i++)
+            ;
+        if(i < outputCount || i < firstCount){
+            printf("differs: ");
+            if(i < outputCount && i < firstCount)
+                printf("number %d it wrote is %d, not %d\n", i+1, outputs[i], firstOutputs[i]);
+            else
+                printf("wrote %d numbers, not %d\n", outputCount, firstCount);
+            differs = 1;
+        }
+        else if(sp != firstSp || bp != firstBp){
+            printf("differs: finished with sp %d bp %d\n", sp, bp);
+            differs = 1;
+        }
+        else{
+            for(i=0; i<=stackHeight && stack[i] == first[i]; i++)
+                ;
+            if(i <= stackHeight){
+                printf("differs: left %d in stack[%d], not %d\n", stack[i], i, first[i]);
+                differs = 1;
+            }
+            else
+                printf("agrees\n");
+        }
+        free(outputs);
+    }
+    free(firstOutputs);
+    free(first);
+    outputs = NULL;
+    return differs;
+}
+
+/// bytes of memory that are only taken as they're touched, ending right before a page nobody may touch, which guard
+/// is pointed at. NULL if there isn't the room
+void *reserve(size_t bytes, char **guard)
+{
+#ifndef _WIN32
+    size_t page = sysconf(_SC_PAGESIZE), size = (bytes + page-1) / page * page;
+    char *at = mmap(NULL, size + page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if(at == MAP_FAILED)
+        return NULL;
+    if(mprotect(at + size, page, PROT_NONE) != 0){
+        munmap(at, size + page);
+        return NULL;
+    }
+    *guard = at + size;
+    return at + size - bytes;
+#else
+    *guard = NULL;              // no guard page here, only INC and CAL are checked
+    return calloc(bytes, 1);
+#endif
+}
+
+/// the stack, and the display and calls for as deep as it lets calls go. INC and CAL check they fit, anything else
+/// that runs off the top pushes into the guard page and stackOnSignal() stops the program
+int reserveStack()
+{
+    char *guard;
+
+    maxCallDepth = stackHeight/4;
+    stack = reserve((size_t)(stackHeight+1) * sizeof(int), &stackGuard);
+    display = reserve((size_t)(maxCallDepth+1) * sizeof(int), &guard);
+    calls = reserve((size_t)maxCallDepth * sizeof(callRecord), &guard);
+    if(stack == NULL || display == NULL || calls == NULL){
+        printf("No room for a stack of %d slots\nExiting Program ...\n", stackHeight);
+        return 1;
+    }
+#ifndef _WIN32
+    struct sigaction action;
+    stackGuardSize = sysconf(_SC_PAGESIZE);
+    stackFullLength = snprintf(stackFull, sizeof(stackFull),
+                               "\nA push ran past the top of the stack, which has %d slots\nExiting Program ...\n", stackHeight);
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = stackOnSignal;
+    action.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &action, NULL);
+    sigaction(SIGBUS, &action, NULL);       // what some systems raise for a guard page instead
+#endif
+    return 0;
+}
+
+/// every slot back to 0. With mmap the pages go back instead, so the next run only takes what it touches again
+void clearStack()
+{
+#ifndef _WIN32
+    size_t page = sysconf(_SC_PAGESIZE), size = ((stackHeight+1) * sizeof(int) + page-1) / page * page;
+    if(madvise(stackGuard - size, size, MADV_DONTNEED) == 0)
+        return;
+#endif
+    memset(stack, 0, (size_t)(stackHeight+1) * sizeof(int));
+}
+
+/// the INC or CAL at addr needs more of the stack than there is
+void stackOverflow(int addr)
+{
+    printf("\n%s %d %d at %d runs off the top of the stack, which has %d slots\nExiting Program ...\n",
+           opcodes[code[addr].op], code[addr].l, code[addr].m, addr, stackHeight);
+    exit(1);
+}
+
+#ifndef _WIN32
+/// a push ran into the guard page, or the VM crashed some other way, in which case crash the way it would have.
+/// Only write(), lseek() and _exit() from here, stdio may be half way through something
+void stackOnSignal(int sig, siginfo_t *info, void *context)
+{
+    char *at = info->si_addr;
+
+    (void)context;
+    if(stackGuard != NULL && at >= stackGuard && at < stackGuard + stackGuardSize){
+        traceOnCrash();                 // _exit() won't close it, and the steps up to here are what the trace is for
+        if(write(2, stackFull, stackFullLength)){}     // nothing more to do if it fails
+        _exit(1);
+    }
+    traceOnSignal(sig);
+}
+#endif
+
+#ifdef VM_JIT
+/// the JIT: code[] becomes x86-64 in a buffer of its own, a stretch of machine code for each instruction. While it runs,
+/// rbx holds stack, r15 &stack[sp], r14 &stack[bp] and r13d the top of the stack. stack[sp] is only brought up to date
+/// when the top is pushed under something or popped off, so the stack always ends up just as the other engines leave it.
+/// CAL, RET, SIO and LOD/STO more than 0 levels down go through the same C the other engines use
+#define RAX 0
+#define RCX 1
+#define RDX 2
+#define RBX 3
+#define RDI 7
+#define R13 13
+#define R14 14
+#define R15 15
+#define JIT_MAX_BYTES 128       // the longest stretch of machine code an instruction can become
+
+typedef struct
+{
+    unsigned char *code;
+    size_t size;
+    size_t used;
+    int *native;        // by address, where its machine code starts, and the end of the program after the last one
+    int *fixups;        // pairs of where a jump's rel32 is and the address it goes to
+    int fixupCount;
+}jitBuffer;
+
+void **jitTargets = NULL;   // by address, where its machine code is, for RET to go back to
+
+void emit(jitBuffer *j, int count, ...)
+{
+    va_list bytes;
+    va_start(bytes, count);
+    while(count-- > 0)
+        j->code[j->used++] = (unsigned char)va_arg(bytes, int);
+    va_end(bytes);
+}
+
+void emit32(jitBuffer *j, int n)
+{
+    memcpy(j->code + j->used, &n, 4);
+    j->used += 4;
+}
+
+void emit64(jitBuffer *j, const void *p)
+{
+    memcpy(j->code + j->used, &p, 8);
+    j->used += 8;
+}
+
+/// op reg, [base+disp] in its 32 bit form, or 64 bit with w. base is never rsp, rbp, r12 or r13
+void emitMem(jitBuffer *j, int w, int op, int reg, int base, int disp)
+{
+    int rex = 0x40 | w<<3 | (reg>>3)<<2 | base>>3;
+    if(rex != 0x40)
+        emit(j, 1, rex);
+    if(op > 0xFF)
+        emit(j, 1, op>>8);
+    emit(j, 1, op & 0xFF);
+    if(disp >= -128 && disp <= 127)
+        emit(j, 2, 0x40 | (reg&7)<<3 | (base&7), disp & 0xFF);
+    else{
+        emit(j, 1, 0x80 | (reg&7)<<3 | (base&7));
+        emit32(j, disp);
+    }
+}
+
+/// op reg, [rbx+index*4+disp], index being rax or rcx with the frame() of a variable in its low half
+void emitIndexed(jitBuffer *j, int op, int reg, int index, int disp)
+{
+    emit(j, 3, 0x48, 0x63, 0xC0 | index<<3 | index);       // movsxd index, its low half
+    if(reg >= 8)
+        emit(j, 1, 0x44);
+    if(op > 0xFF)
+        emit(j, 1, op>>8);
+    emit(j, 1, op & 0xFF);
+    emit(j, 2, 0x84 | (reg&7)<<3, 0x80 | index<<3 | RBX);
+    emit32(j, disp);
+}
+
+void emitCall(jitBuffer *j, const void *function)
+{
+    emit(j, 2, 0x48, 0xB8);                         // movabs rax, function
+    emit64(j, function);
+    emit(j, 2, 0xFF, 0xD0);                         // call rax
+}
+
+/// jump to the machine code for address to, op is E9 for jmp or the second byte of a 0F 8x jcc
+void emitJump(jitBuffer *j, int op, int to)
+{
+    if(op == 0xE9)
+        emit(j, 1, 0xE9);
+    else
+        emit(j, 2, 0x0F, op);
+    j->fixups[2*j->fixupCount] = j->used;
+    j->fixups[2*j->fixupCount+1] = (unsigned)to < (unsigned)codeSize ? to : codeSize;
+    j->fixupCount++;
+    emit32(j, 0);
+}
+
+void emitFlush(jitBuffer *j)                        // mov [r15], r13d
+{
+    emitMem(j, 0, 0x89, R13, R15, 0);
+}
+
+void emitPush(jitBuffer *j)                         // flush, then add r15, 4
+{
+    emitFlush(j);
+    emit(j, 4, 0x49, 0x83, 0xC7, 0x04);
+}
+
+void emitPop(jitBuffer *j, int count)               // flush, sub r15, 4*count, then mov r13d, [r15]
+{
+    emitFlush(j);
+    emit(j, 4, 0x49, 0x83, 0xEF, 4*count);
+    emitMem(j, 0, 0x8B, R13, R15, 0);
+}
+
+void emitStoreSp(jitBuffer *j)                      // sp = (r15-rbx)/4
+{
+    emit(j, 10, 0x4C, 0x89, 0xF9, 0x48, 0x29, 0xD9, 0x48, 0xC1, 0xF9, 0x02);
+    emit(j, 2, 0x48, 0xBA);
+    emit64(j, &sp);
+    emit(j, 2, 0x89, 0x0A);
+}
+
+/// r15 = &stack[sp], r14 = &stack[bp] and r13d = stack[sp], after C has moved them. Leaves rax alone
+void emitLoadRegisters(jitBuffer *j, int withSp)
+{
+    if(withSp){
+        emit(j, 2, 0x48, 0xB9);
+        emit64(j, &sp);
+        emit(j, 7, 0x48, 0x63, 0x09, 0x4C, 0x8D, 0x3C, 0x8B);      // movsxd rcx, [rcx]; lea r15, [rbx+rcx*4]
+        emitMem(j, 0, 0x8B, R13, R15, 0);
+    }
+    emit(j, 2, 0x48, 0xB9);
+    emit64(j, &bp);
+    emit(j, 7, 0x48, 0x63, 0x09, 0x4C, 0x8D, 0x34, 0x8B);          // movsxd rcx, [rcx]; lea r14, [rbx+rcx*4]
+}
+
+/// eax = frame(l)
+void emitFrame(jitBuffer *j, int l)
+{
+    emit(j, 1, 0xBF);
+    emit32(j, l);
+    emitCall(j, frame);
+}
+
+void jitBadInstruction(int op)
+{
+    printf(op == 2 ? "error executing OPR\n" : "SIO error\n");
+}
+
+void *jitReturn()
+{
+    int to = returnFromProcedure();
+    return jitTargets[(unsigned)to < (unsigned)codeSize ? to : codeSize];
+}
+
+/// compile code[] and run it from pc, returns 1 if it couldn't be compiled and nothing ran
+int runJit()
+{
+    static const int setcc[] = {0x94, 0x95, 0x9C, 0x9E, 0x9F, 0x9D};     // EQL NEQ LSS LEQ GTR GEQ
+    static const int arithOp[] = {0x03, 0x2B, 0x0FAF};                  // add, sub, imul r13d, [..]
+    jitBuffer j;
+    void (*run)(int *, void *);
+    instr in;
+    int i, k, rel, failed = 1;
+
+    memset(&j, 0, sizeof(j));
+    j.size = (size_t)(codeSize+2) * JIT_MAX_BYTES;
+    j.code = mmap(NULL, j.size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    j.native = malloc((codeSize+1) * sizeof(int));
+    j.fixups = malloc(2 * (codeSize+1) * sizeof(int));
+    jitTargets = malloc((codeSize+1) * sizeof(void *));
+    if(j.code == MAP_FAILED || j.native == NULL || j.fixups == NULL || jitTargets == NULL)
+        goto out;
+
+    ///enter from C: save what we use, rbx = stack, load the registers and jump to the start
+    emit(&j, 9, 0x53, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57);  // push rbx, r12, r13, r14, r15
+    emit(&j, 3, 0x48, 0x89, 0xFB);                                      // mov rbx, rdi
+    emitLoadRegisters(&j, 1);
+    emit(&j, 2, 0xFF, 0xE6);                                            // jmp rsi
+
+    for(i=0; i<codeSize; i++){
+        in = code[i];
+        j.native[i] = j.used;
+        switch(in.op){
+            case 1:         // LIT
+                emitPush(&j);
+                emit(&j, 2, 0x41, 0xBD);
+                emit32(&j, in.m);
+                break;
+            case 2:
+                switch(in.m){
+                    case 0:         // RET
+                        emitFlush(&j);
+                        emitCall(&j, jitReturn);
+                        emitLoadRegisters(&j, 1);
+                        emit(&j, 2, 0xFF, 0xE0);                        // jmp rax
+                        break;
+                    case 1:         // NEG
+                        emit(&j, 3, 0x41, 0xF7, 0xDD);
+                        break;
+                    case 2: case 3: case 4: case 5: case 7:         // ADD SUB MUL DIV MOD
+                        emitFlush(&j);
+                        emitMem(&j, 0, 0x8B, RAX, R15, -4);             // mov eax, [r15-4]
+                        if(in.m == 2)
+                            emit(&j, 3, 0x44, 0x01, 0xE8);              // add eax, r13d
+                        else if(in.m == 3)
+                            emit(&j, 3, 0x44, 0x29, 0xE8);              // sub eax, r13d
+                        else if(in.m == 4)
+                            emit(&j, 4, 0x41, 0x0F, 0xAF, 0xC5);        // imul eax, r13d
+                        else
+                            emit(&j, 4, 0x99, 0x41, 0xF7, 0xFD);        // cdq; idiv r13d
+                        emit(&j, 3, 0x41, 0x89, in.m == 7 ? 0xD5 : 0xC5);   // mov r13d, eax or edx
+                        emit(&j, 4, 0x49, 0x83, 0xEF, 0x04);            // sub r15, 4
+                        break;
+                    case 6:         // ODD
+                        emit(&j, 4, 0x41, 0x83, 0xE5, 0x01);
+                        break;
+                    case 8: case 9: case 10: case 11: case 12: case 13:    // EQL NEQ LSS LEQ GTR GEQ
+                        emitFlush(&j);
+                        emitMem(&j, 0, 0x8B, RAX, R15, -4);
+                        emit(&j, 3, 0x44, 0x39, 0xE8);                  // cmp eax, r13d
+                        emit(&j, 3, 0x0F, setcc[in.m-8], 0xC0);         // setcc al
+                        emit(&j, 4, 0x44, 0x0F, 0xB6, 0xE8);            // movzx r13d, al
+                        emit(&j, 4, 0x49, 0x83, 0xEF, 0x04);
+                        break;
+                    default:
+                        emit(&j, 1, 0xBF);
+                        emit32(&j, 2);
+                        emitCall(&j, jitBadInstruction);
+                }
+                break;
+            case 3:         // LOD
+                emitPush(&j);
+                if(in.l == 0)
+                    emitMem(&j, 0, 0x8B, R13, R14, 4*in.m);
+                else{
+                    emitFrame(&j, in.l);
+                    emitIndexed(&j, 0x8B, R13, RAX, 4*in.m);
+                }
+                break;
+            case 4:         // STO
+                if(in.l == 0)
+                    emitMem(&j, 0, 0x89, R13, R14, 4*in.m);
+                else{
+                    emitFrame(&j, in.l);
+                    emitIndexed(&j, 0x89, R13, RAX, 4*in.m);
+                }
+                emitPop(&j, 1);
+                break;
+            case 5:         // CAL
+                emitFlush(&j);
+                emitStoreSp(&j);
+                emit(&j, 1, 0xBF);
+                emit32(&j, in.l);
+                emit(&j, 1, 0xBE);
+                emit32(&j, in.m);
+                emit(&j, 1, 0xBA);
+                emit32(&j, i+1);
+                emitCall(&j, callProcedure);
+                emitLoadRegisters(&j, 0);
+                emitJump(&j, 0xE9, in.m);
+                break;
+            case 6:         // INC
+                emitFlush(&j);
+                if((long long)in.m > stackHeight){                      // can't fit whatever sp is
+                    emit(&j, 1, 0xBF);
+                    emit32(&j, i);
+                    emitCall(&j, stackOverflow);
+                    break;
+                }
+                emit(&j, 3, 0x49, 0x81, 0xC7);
+                emit32(&j, 4*in.m);
+                emit(&j, 3, 0x48, 0x8D, 0x83);                          // lea rax, [rbx+4*stackHeight]
+                emit32(&j, 4*stackHeight);
+                emit(&j, 5, 0x49, 0x39, 0xC7, 0x76, 17);                // cmp r15, rax; jbe past the call
+                emit(&j, 1, 0xBF);
+                emit32(&j, i);
+                emitCall(&j, stackOverflow);
+                emitMem(&j, 0, 0x8B, R13, R15, 0);
+                break;
+            case 7:         // JMP
+                emitJump(&j, 0xE9, in.m);
+                break;
+            case 8: case 24:        // JPC, JNZ
+                emit(&j, 3, 0x44, 0x89, 0xE8);                          // mov eax, r13d
+                emitPop(&j, 1);
+                emit(&j, 2, 0x85, 0xC0);                                // test eax, eax
+                emitJump(&j, in.op == 8 ? 0x84 : 0x85, in.m);
+                break;
+            case 10: case 11: case 12: case 13: case 14: case 15:      // JEQ JNE JLT JLE JGT JGE
+                emitMem(&j, 0, 0x8B, RAX, R15, -4);
+                emit(&j, 3, 0x44, 0x89, 0xE9);                          // mov ecx, r13d
+                emitPop(&j, 2);
+                emit(&j, 2, 0x39, 0xC8);                                // cmp eax, ecx
+                emitJump(&j, setcc[in.op-10] - 0x10, in.m);             // the jcc for the same condition as the setcc
+                break;
+            case 16: case 17: case 18: case 19:                         // LADD LSUB LMUL LDIV
+                emitFlush(&j);                                          // in case the variable is the top itself
+                if(in.l != 0){
+                    emitFrame(&j, in.l);
+                    emit(&j, 2, 0x89, 0xC1);                            // mov ecx, eax
+                }
+                if(in.op == 19)
+                    emit(&j, 4, 0x44, 0x89, 0xE8, 0x99);                // mov eax, r13d; cdq
+                k = in.op == 19 ? 0xF7 : arithOp[in.op-16];             // idiv is F7 /7
+                if(in.l == 0)
+                    emitMem(&j, 0, k, in.op == 19 ? 7 : R13, R14, 4*in.m);
+                else
+                    emitIndexed(&j, k, in.op == 19 ? 7 : R13, RCX, 4*in.m);
+                if(in.op == 19)
+                    emit(&j, 3, 0x41, 0x89, 0xC5);                      // mov r13d, eax
+                break;
+            case 20: case 21: case 22: case 23:                         // IADD ISUB IMUL IDIV
+                if(in.op == 20)
+                    emit(&j, 3, 0x41, 0x81, 0xC5);
+                else if(in.op == 21)
+                    emit(&j, 3, 0x41, 0x81, 0xED);
+                else if(in.op == 22)
+                    emit(&j, 3, 0x45, 0x69, 0xED);
+                else
+                    emit(&j, 1, 0xB9);                                  // mov ecx, m
+                emit32(&j, in.m);
+                if(in.op == 23)
+                    emit(&j, 9, 0x44, 0x89, 0xE8, 0x99, 0xF7, 0xF9, 0x41, 0x89, 0xC5);    // mov eax, r13d; cdq; idiv ecx; mov r13d, eax
+                break;
+            case 9:
+                if(in.m == 0){              // OUT
+                    emit(&j, 3, 0x44, 0x89, 0xEF);                      // mov edi, r13d
+                    emitCall(&j, writeNumber);
+                    emitPop(&j, 1);
+                }
+                else if(in.m == 1){         // INP
+                    emitPush(&j);
+                    emit(&j, 3, 0x4C, 0x89, 0xFF);                      // mov rdi, r15
+                    emitCall(&j, readNumber);
+                    emitMem(&j, 0, 0x8B, R13, R15, 0);
+                }
+                else if(in.m == 2)          // HLT
+                    emitJump(&j, 0xE9, codeSize);
+                else{
+                    emit(&j, 1, 0xBF);
+                    emit32(&j, 9);
+                    emitCall(&j, jitBadInstruction);
+                }
+                break;
+            default:
+                ;
+        }
+    }
+
+    ///the end of the program, where HLT and running off the end go: leave sp and the stack as the other engines would
+    j.native[codeSize] = j.used;
+    emitFlush(&j);
+    emitStoreSp(&j);
+    emit(&j, 9, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5B);  // pop r15, r14, r13, r12, rbx
+    emit(&j, 1, 0xC3);
+
+    for(i=0; i<j.fixupCount; i++){
+        rel = j.native[j.fixups[2*i+1]] - (j.fixups[2*i] + 4);
+        memcpy(j.code + j.fixups[2*i], &rel, 4);
+    }
+    for(i=0; i<=codeSize; i++)
+        jitTargets[i] = j.code + j.native[i];
+    if(mprotect(j.code, j.size, PROT_READ | PROT_EXEC) != 0)
+        goto out;
+
+    run = (void (*)(int *, void *))j.code;
+    run(stack, jitTargets[(unsigned)pc < (unsigned)codeSize ? pc : codeSize]);
+    failed = 0;
+out:
+    if(j.code != MAP_FAILED && j.code != NULL)
+        munmap(j.code, j.size);
+    free(j.native);
+    free(j.fixups);
+    free(jitTargets);
+    jitTargets = NULL;
+    return failed;
+}
+#endif
+
+int halt()
+{
+    if(ir.op == 9 && ir.m == 2)
+        return 1;
+    if (pc >= codeSize)         // ran off the end of the program
+        return 1;
+    return 0;
+}
+
+int base(int level, int b)
+{
+    while(level>0){
+        b = stack[b+1];
+        level--;
+    }
+    return b;
+}
+
+/// base of the frame level static links down from the running one, without walking them
+int frame(int level)
+{
+    if(level >= 0 && level <= curLevel)
+        return display[curLevel - level];
+    return base(level, bp);     // past the main block's frame, or L < 0 which base() takes as 0. Only a hand written program goes there
+}
+
+/// rel counts from 0 in the order of OPR EQL NEQ LSS LEQ GTR GEQ
+int compare(int rel, int a, int b)
+{
+    switch(rel){
+        case 0: return a == b;
+        case 1: return a != b;
+        case 2: return a < b;
+        case 3: return a <= b;
+        case 4: return a > b;
+        default: return a >= b;
+    }
+}
+
+/// opr counts from 0 in the order of OPR ADD SUB MUL DIV
+int arith(int opr, int a, int b)
+{
+    switch(opr){
+        case 0: return a + b;
+        case 1: return a - b;
+        case 2: return a * b;
+        default: return a / b;
+    }
+}
+
+/**
+bp>1
+    write_Stack(output_file, stack[bp+2], bp-1};
+bp<sp
+    print |
+    printstack
+else
+bp<sp
+printStack
+**/